@@ -111,5 +111,8 @@ void loop()
   // 处理Home Assistant MQTT消息
   haManager.loop();
   
+  // 存储后台维护（码库压缩、索引快照）
+  dataStore.Update();
+  
   delay(10);
 }
\ No newline at end of file
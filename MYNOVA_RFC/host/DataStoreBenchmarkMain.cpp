@@ -0,0 +1,78 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <iostream>
+#include "DataStoreBenchmark.h"
+
+/*
+ * 主机上运行存储基准测试：NVS后端使用内存中的 Preferences 替身，
+ * 先写入若干槽位，再执行与 /api/datastore/benchmark 相同的测试并输出JSON结果。
+ *
+ * 用法：datastore_benchmark [--slots N] [--iterations N] [--list-passes N] [--config-loads N] [--saves N]
+ */
+
+static bool parseArg(int argc, char** argv, int& i, const char* name, unsigned int& value)
+{
+    if (strcmp(argv[i], name) != 0 || i + 1 >= argc) {
+        return false;
+    }
+    value = (unsigned int)strtoul(argv[++i], nullptr, 10);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    DataStoreBenchmarkConfig config = DataStoreBenchmark::DefaultConfig();
+    unsigned int slots = RADIO_DATA_SLOT_COUNT / 2;
+    for (int i = 1; i < argc; i++) {
+        if (!parseArg(argc, argv, i, "--slots", slots) &&
+            !parseArg(argc, argv, i, "--iterations", config.iterations) &&
+            !parseArg(argc, argv, i, "--list-passes", config.listPasses) &&
+            !parseArg(argc, argv, i, "--config-loads", config.configLoads) &&
+            !parseArg(argc, argv, i, "--saves", config.saves)) {
+            fprintf(stderr, "未知参数: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (slots > RADIO_DATA_SLOT_COUNT) {
+        slots = RADIO_DATA_SLOT_COUNT;
+    }
+
+    Preferences::ResetStorage();
+    DataStore store;
+
+    // 写入测试数据：编码各不相同，名称长度接近上限
+    RadioData radioData;
+    for (unsigned int index = 1; index <= slots; index++) {
+        char name[RADIO_NAME_MAX_BYTES + 1];
+        snprintf(name, sizeof(name), "遥控器按键 %u", index);
+        radioData.name = name;
+        radioData.rcData.data = 0x510000UL + index;
+        radioData.rcData.bitLength = 24;
+        radioData.rcData.protocal = 1 + index % 2;
+        radioData.rcData.pulseLength = 350;
+        radioData.rcData.freqType = (index % 3 == 0) ? FREQ_315 : FREQ_433;
+        if (!store.SaveData(index, radioData)) {
+            fprintf(stderr, "写入槽位 %u 失败\n", index);
+            return 1;
+        }
+    }
+
+    JsonDocument result;
+    DataStoreBenchmark benchmark(&store);
+    benchmark.Run(config, result);
+    serializeJsonPretty(result, std::cout);
+    std::cout << std::endl;
+
+    // 基准测试不应改动已有数据
+    if (result["occupied"].as<unsigned int>() != slots || store.GetOccupiedCount() != (int)slots) {
+        fprintf(stderr, "已占用槽位数不符: %d / %u\n", store.GetOccupiedCount(), slots);
+        return 1;
+    }
+    return 0;
+}
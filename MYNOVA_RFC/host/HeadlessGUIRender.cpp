@@ -0,0 +1,94 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "GUIRender.h"
+#include <U8g2lib.h>
+#include "GUI/UIEngine.h"
+#include "Pages/HomePage.h"
+
+/*
+ * 无屏界面构建中的 GUIRender：u8g2 使用 SSD1306 128x64 全缓冲但不连接屏幕，
+ * 不启动渲染与传输任务，帧由 UIHeadlessMain.cpp 按脚本逐帧绘制。
+ */
+
+class HeadlessU8G2 : public U8G2
+{
+public:
+    HeadlessU8G2() : U8G2()
+    {
+        u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    }
+};
+
+static HeadlessU8G2 u8g2;
+static bool displaySleeping = false;
+static DisplayStats displayStats = {0};
+
+UIEngine uiEngine;
+HomePage uiPageHome;
+GUIRender guiRender;
+
+GUIRender::GUIRender()
+{
+    drawGUITaskHandle = nullptr;
+    displayTransferTaskHandle = nullptr;
+}
+
+GUIRender::~GUIRender()
+{
+}
+
+void GUIRender::initDisplay()
+{
+    u8g2.begin();
+}
+
+U8G2* GUIRender::getU8G2()
+{
+    return &u8g2;
+}
+
+void GUIRender::init()
+{
+    initDisplay();
+    uiEngine.setCurrentPage(&uiPageHome);
+}
+
+void GUIRender::startRenderTask()
+{
+}
+
+void GUIRender::setBattery(float voltage)
+{
+    uiPageHome.setBattery(voltage);
+    uiEngine.requestRedraw();
+}
+
+void GUIRender::setPowerSave(bool bPowerSave)
+{
+    displaySleeping = bPowerSave;
+}
+
+void GUIRender::setContrast(int contrast)
+{
+    (void)contrast;
+}
+
+void GUIRender::invalidateDisplay()
+{
+}
+
+DisplayStats GUIRender::getDisplayStats()
+{
+    return displayStats;
+}
+
+// 无屏构建中绘制完成的缓冲区就是“屏幕上”的一帧
+bool GUIRender::copyFrame(uint8_t* buffer)
+{
+    memcpy(buffer, u8g2.getBufferPtr(), SCREEN_WIDTH * SCREEN_TILE_HEIGHT);
+    return !displaySleeping;
+}
@@ -0,0 +1,336 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "HostDevices.h"
+#include <WiFi.h>
+#include "DataStore.h"
+#include "SystemSetting.h"
+#include "ButtonHandle.h"
+#include "ButtonDetector.h"
+#include "Buzzer.h"
+#include "OTAUpdater.h"
+#include "IOPin.h"
+
+DataStore dataStore;
+ButtonHandle buttonHandle;
+RadioHelper radioHelper;
+SystemSetting systemSetting;
+WiFiManager wifiManager;
+Buzzer buzzer(PIN_BUZZER);
+WiFiClass WiFi;
+
+// ==================== 射频 ====================
+// 接收帧只保存在一个小环形队列中，发送只记录次数与最近一条
+
+static RadioFrame hostFrames[RADIO_FRAME_QUEUE_SIZE];
+static uint32_t hostFrameSequence = 0;
+static uint32_t hostSentCount = 0;
+static RCData hostLastSent;
+
+void HostInjectRadioFrame(const RCData& rcData)
+{
+    hostFrameSequence++;
+    RadioFrame& frame = hostFrames[hostFrameSequence % RADIO_FRAME_QUEUE_SIZE];
+    frame.sequence = hostFrameSequence;
+    frame.rcData = rcData;
+    frame.timestamp = millis();
+    frame.lastSeen = frame.timestamp;
+    frame.repeatCount = 1;
+}
+
+uint32_t HostGetSentCount()
+{
+    return hostSentCount;
+}
+
+RCData HostGetLastSent()
+{
+    return hostLastSent;
+}
+
+RadioHelper::RadioHelper():
+bReciveMode(false),
+bContinuousMode(false)
+{
+}
+
+void RadioHelper::EnableRecive()
+{
+    bReciveMode = true;
+}
+
+void RadioHelper::DisableRecive()
+{
+    bReciveMode = false;
+}
+
+void RadioHelper::SetRepeatTransmit(int nRepeatTransmit)
+{
+    (void)nRepeatTransmit;
+}
+
+bool RadioHelper::SendData(RCData data)
+{
+    hostLastSent = data;
+    hostSentCount++;
+    return true;
+}
+
+uint32_t RadioHelper::GetFrameSequence()
+{
+    return hostFrameSequence;
+}
+
+bool RadioHelper::ReadFrame(uint32_t& cursor, RadioFrame& frame)
+{
+    if (cursor >= hostFrameSequence) {
+        return false;
+    }
+    // 落后超过队列容量时跳到最旧的一帧
+    if (hostFrameSequence - cursor > RADIO_FRAME_QUEUE_SIZE) {
+        cursor = hostFrameSequence - RADIO_FRAME_QUEUE_SIZE;
+    }
+    cursor++;
+    frame = hostFrames[cursor % RADIO_FRAME_QUEUE_SIZE];
+    return true;
+}
+
+// ==================== 蜂鸣器 / 按键检测 ====================
+// 主机上没有蜂鸣器与GPIO，按键只通过 ButtonHandle::injectEvent() 注入
+
+Buzzer::Buzzer(int pin)
+{
+    (void)pin;
+}
+
+Buzzer::~Buzzer()
+{
+}
+
+void Buzzer::beep(int duration)
+{
+    (void)duration;
+}
+
+ButtonDetector::ButtonDetector(uint8_t button_pin, uint8_t active_level)
+{
+    (void)button_pin;
+    (void)active_level;
+}
+
+ButtonDetector::~ButtonDetector()
+{
+}
+
+void ButtonDetector::attach(ButtonEvent event, ButtonDetectorCallback callback)
+{
+    (void)event;
+    (void)callback;
+}
+
+bool ButtonDetector::start()
+{
+    return true;
+}
+
+uint32_t ButtonDetector::getEventTimestamp() const
+{
+    return micros();
+}
+
+void ButtonDetector::setFastResponseMode(bool enabled)
+{
+    (void)enabled;
+}
+
+void ButtonDetector::setLongPressEnabled(bool enabled)
+{
+    (void)enabled;
+}
+
+// ==================== WiFi / OTA ====================
+// 始终未连接：依赖网络的页面停留在等待连接的状态
+
+WiFiManager::WiFiManager() : scanning(false), scanComplete(false), apStarted(false),
+                             scanTaskHandle(NULL), wifiConnectTaskHandle(NULL),
+                             apSetupTaskHandle(NULL), mutex(NULL), connected(false)
+{
+}
+
+WiFiManager::~WiFiManager()
+{
+}
+
+String WiFiManager::getAPIP()
+{
+    return "10.0.0.1";
+}
+
+OTAUpdater::OTAUpdater()
+{
+}
+
+bool OTAUpdater::checkUpdate(String url, OTAInfo& info)
+{
+    (void)url;
+    (void)info;
+    lastError = "Host build";
+    return false;
+}
+
+bool OTAUpdater::performUpdate(String url, size_t size, int type, ProgressCallback callback)
+{
+    (void)url;
+    (void)size;
+    (void)type;
+    (void)callback;
+    lastError = "Host build";
+    return false;
+}
+
+// ==================== 系统设置 ====================
+// 配置保存在内存中，saveConfig() 时写入 DataStore（内存中的 Preferences 替身）
+
+SystemSetting::SystemSetting()
+{
+    lastActivityTime = 0;
+    isScreenOff = false;
+    pWiFiManager = nullptr;
+    dirtyFields = 0;
+    lastDirtyTime = 0;
+    dirtyLock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&saveStats, 0, sizeof(saveStats));
+    configMutex = xSemaphoreCreateMutex();
+}
+
+void SystemSetting::init(WiFiManager* wifiMgr)
+{
+    pWiFiManager = wifiMgr;
+    config = dataStore.LoadSystemConfig();
+    lastActivityTime = millis();
+}
+
+void SystemSetting::resetIdleTimer()
+{
+    lastActivityTime = millis();
+}
+
+SystemConfig SystemSetting::getConfig()
+{
+    return config;
+}
+
+void SystemSetting::setConfig(SystemConfig newConfig, bool saveToFlash)
+{
+    config = newConfig;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_ALL;
+    }
+}
+
+void SystemSetting::saveConfig()
+{
+    if (dirtyFields != 0) {
+        saveStats.keysWritten += dataStore.SaveSystemConfig(config, dirtyFields);
+        saveStats.flushCount++;
+        dirtyFields = 0;
+    }
+}
+
+void SystemSetting::discardPendingSave()
+{
+    dirtyFields = 0;
+}
+
+void SystemSetting::setBrightness(int brightness, bool saveToFlash)
+{
+    config.brightness = brightness;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_BRIGHTNESS;
+    }
+}
+
+void SystemSetting::setBuzzerEnable(bool enable, bool saveToFlash)
+{
+    config.buzzerEnable = enable;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_BUZZER_ENABLE;
+    }
+}
+
+void SystemSetting::setRepeatTransmit(int times, bool saveToFlash)
+{
+    config.repeatTransmit = times;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_REPEAT_TRANSMIT;
+    }
+}
+
+void SystemSetting::setAutoSleepTime(long timeMs, bool saveToFlash)
+{
+    config.autoSleepTime = timeMs;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_AUTO_SLEEP_TIME;
+    }
+}
+
+void SystemSetting::setAutoScreenOffTime(long timeMs, bool saveToFlash)
+{
+    config.autoScreenOffTime = timeMs;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_AUTO_SCREEN_OFF;
+    }
+}
+
+void SystemSetting::setAPEnabled(bool enabled, bool saveToFlash)
+{
+    config.APEnabled = enabled;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_AP_ENABLED;
+    }
+}
+
+void SystemSetting::setWifiEnabled(bool enabled, bool saveToFlash)
+{
+    config.WifiEnabled = enabled;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_WIFI_ENABLED;
+    }
+}
+
+void SystemSetting::setAPConfig(String name, String password, bool saveToFlash)
+{
+    config.APName = name;
+    config.APPassword = password;
+    if (saveToFlash) {
+        dirtyFields |= CONFIG_FIELD_AP_NAME | CONFIG_FIELD_AP_PASSWORD;
+    }
+}
+
+bool SystemSetting::getBuzzerEnable()
+{
+    return config.buzzerEnable;
+}
+
+int SystemSetting::getBrightness()
+{
+    return config.brightness;
+}
+
+int SystemSetting::getRepeatTransmit()
+{
+    return config.repeatTransmit;
+}
+
+long SystemSetting::getAutoSleepTime()
+{
+    return config.autoSleepTime;
+}
+
+long SystemSetting::getAutoScreenOffTime()
+{
+    return config.autoScreenOffTime;
+}
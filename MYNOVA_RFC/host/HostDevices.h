@@ -0,0 +1,23 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOSTDEVICES_H__
+#define __HOSTDEVICES_H__
+#include <Arduino.h>
+#include "RadioHelper.h"
+
+/*
+ * 无屏界面构建中替代硬件的模块（射频、蜂鸣器、WiFi、OTA、按键检测、系统设置）。
+ * 这些类的方法在 HostDevices.cpp 中以主机版本实现，下面是脚本驱动用的附加接口。
+ */
+
+// 模拟收到一帧遥控信号，接收页面通过 ReadFrame() 读到它
+void HostInjectRadioFrame(const RCData& rcData);
+// 页面发出的遥控码数量与最近一条
+uint32_t HostGetSentCount();
+RCData HostGetLastSent();
+
+#endif
@@ -0,0 +1,86 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include <Arduino.h>
+#include <iostream>
+#include "RadioBenchmark.h"
+#include "Lib/RCSwitch.h"
+
+/*
+ * 主机上运行解码器基准测试：与 /api/radio/benchmark 相同，为每个协议合成时序捕获并回放给解码器，
+ * 输出JSON结果。--compare 时分别以候选索引和线性扫描各运行一次，两者的正确解码数必须一致。
+ *
+ * 用法：radio_benchmark [--frames N] [--bits N] [--jitter us] [--noise 百分比] [--noise-frames N]
+ *                       [--seed N] [--index 0|1] [--compare]
+ */
+
+static bool parseArg(int argc, char** argv, int& i, const char* name, unsigned int& value)
+{
+    if (strcmp(argv[i], name) != 0 || i + 1 >= argc) {
+        return false;
+    }
+    value = (unsigned int)strtoul(argv[++i], nullptr, 10);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkConfig config = RadioBenchmark::DefaultConfig();
+    unsigned int index = config.protocolIndex ? 1 : 0;
+    unsigned int seed = config.seed;
+    bool compare = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--compare") == 0) {
+            compare = true;
+        } else if (!parseArg(argc, argv, i, "--frames", config.framesPerProtocol) &&
+                   !parseArg(argc, argv, i, "--bits", config.bitLength) &&
+                   !parseArg(argc, argv, i, "--jitter", config.jitter) &&
+                   !parseArg(argc, argv, i, "--noise", config.noise) &&
+                   !parseArg(argc, argv, i, "--noise-frames", config.noiseFrames) &&
+                   !parseArg(argc, argv, i, "--seed", seed) &&
+                   !parseArg(argc, argv, i, "--index", index)) {
+            fprintf(stderr, "未知参数: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    config.seed = seed;
+    config.protocolIndex = index != 0;
+
+    // 代表接收任务中的解码器：基准测试切换索引不能影响它
+    RCSwitch receiver;
+    RadioBenchmark benchmark;
+
+    JsonDocument result;
+    benchmark.Run(config, result);
+    serializeJsonPretty(result, std::cout);
+    std::cout << std::endl;
+
+    if (compare) {
+        BenchmarkConfig other = config;
+        other.protocolIndex = !config.protocolIndex;
+        JsonDocument otherResult;
+        benchmark.Run(other, otherResult);
+
+        JsonArray a = result["protocols"].as<JsonArray>();
+        JsonArray b = otherResult["protocols"].as<JsonArray>();
+        for (size_t i = 0; i < a.size(); i++) {
+            if (a[i]["correct"].as<unsigned int>() != b[i]["correct"].as<unsigned int>()) {
+                fprintf(stderr, "协议 %u 正确解码数不一致: 索引%s %u / %u\n", a[i]["protocol"].as<unsigned int>(),
+                        config.protocolIndex ? "开" : "关", a[i]["correct"].as<unsigned int>(), b[i]["correct"].as<unsigned int>());
+                return 1;
+            }
+        }
+        fprintf(stderr, "尝试次数/帧: 索引%s %.2f, 索引%s %.2f\n",
+                config.protocolIndex ? "开" : "关", result["summary"]["attemptsPerFrame"].as<float>(),
+                other.protocolIndex ? "开" : "关", otherResult["summary"]["attemptsPerFrame"].as<float>());
+    }
+
+    if (!receiver.isProtocolIndexEnabled()) {
+        fprintf(stderr, "基准测试改变了其他解码实例的协议索引设置\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,295 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "GUIRender.h"
+#include "ButtonHandle.h"
+#include "SystemSetting.h"
+#include "DataStore.h"
+#include "GUI/UIEngine.h"
+#include "Pages/HomePage.h"
+#include "HostDevices.h"
+
+/*
+ * 无屏界面脚本驱动：按脚本注入按键、推进时间，并把指定的帧保存为PBM(P4)，
+ * 与基准图像目录中的同名文件逐字节对比。时钟为手动时钟，每帧推进 GUI_FRAME_INTERVAL_MS。
+ *
+ * 用法：ui_headless <脚本> [--out 输出目录] [--golden 基准图像目录]
+ *
+ * 脚本每行一条命令（# 开头为注释）：
+ *   key <back|menu|enter|1-9> ...              依次注入按键，每个按键分发后继续绘制直到队列为空
+ *   wait <毫秒>                                逐帧推进时间（动画、页面定时逻辑）
+ *   frame <名称>                               保存当前帧为 <名称>.pbm
+ *   rx <315|433> <十六进制数据> <位长> <协议>    模拟收到一帧遥控信号
+ *   slot <序号> <315|433> <十六进制数据> <位长> <协议> <名称>   预先写入一个槽位
+ */
+
+extern UIEngine uiEngine;
+extern HomePage uiPageHome;
+extern GUIRender guiRender;
+extern ButtonHandle buttonHandle;
+extern SystemSetting systemSetting;
+extern WiFiManager wifiManager;
+extern DataStore dataStore;
+
+#define PBM_HEADER_FORMAT "P4\n%d %d\n"
+
+static std::string outputDir = "frames";
+static std::string goldenDir;
+static int frameCount = 0;
+static int mismatchCount = 0;
+
+// 与渲染任务中的一帧相同：分发按键、更新、绘制
+static void renderFrame()
+{
+    uint32_t timestamps[BUTTON_EVENT_QUEUE_SIZE];
+    buttonHandle.processEvents(timestamps, BUTTON_EVENT_QUEUE_SIZE);
+    uiEngine.update();
+    U8G2* u8g2 = guiRender.getU8G2();
+    u8g2->clearBuffer();
+    uiEngine.render(u8g2);
+    HostClockAdvance(GUI_FRAME_INTERVAL_MS * 1000UL);
+    frameCount++;
+}
+
+// 分块布局（每字节为竖向8个像素）转换为按行排列、高位在前的PBM位图
+static std::vector<uint8_t> encodeFrame()
+{
+    uint8_t frame[SCREEN_WIDTH * SCREEN_TILE_HEIGHT];
+    guiRender.copyFrame(frame);
+    char header[16];
+    const int headerLength = snprintf(header, sizeof(header), PBM_HEADER_FORMAT, SCREEN_WIDTH, SCREEN_HEIGHT);
+    std::vector<uint8_t> pbm(headerLength + SCREEN_WIDTH * SCREEN_HEIGHT / 8, 0);
+    memcpy(pbm.data(), header, headerLength);
+    uint8_t* bits = pbm.data() + headerLength;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        const uint8_t* tileRow = frame + (y / 8) * SCREEN_WIDTH;
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (tileRow[x] & (1 << (y % 8))) {
+                bits[y * (SCREEN_WIDTH / 8) + x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+    }
+    return pbm;
+}
+
+static bool readFile(const std::string& path, std::vector<uint8_t>& data)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buffer[1024];
+    size_t n;
+    data.clear();
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + n);
+    }
+    fclose(file);
+    return true;
+}
+
+static bool dumpFrame(const std::string& name)
+{
+    const std::vector<uint8_t> pbm = encodeFrame();
+    const std::string path = outputDir + "/" + name + ".pbm";
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr || fwrite(pbm.data(), 1, pbm.size(), file) != pbm.size()) {
+        fprintf(stderr, "无法写入 %s\n", path.c_str());
+        if (file != nullptr) {
+            fclose(file);
+        }
+        return false;
+    }
+    fclose(file);
+
+    if (!goldenDir.empty()) {
+        std::vector<uint8_t> golden;
+        if (!readFile(goldenDir + "/" + name + ".pbm", golden)) {
+            fprintf(stderr, "[缺少基准] %s\n", name.c_str());
+            mismatchCount++;
+        } else if (golden != pbm) {
+            fprintf(stderr, "[不一致] %s\n", name.c_str());
+            mismatchCount++;
+        } else {
+            printf("[一致] %s\n", name.c_str());
+        }
+    }
+    return true;
+}
+
+static bool parseKey(const std::string& key, ButtonHandleEvent& event)
+{
+    if (key == "back") {
+        event = BTN_BACK;
+    } else if (key == "menu") {
+        event = BTN_MENU;
+    } else if (key == "enter") {
+        event = BTN_ENTER;
+    } else if (key.length() == 1 && key[0] >= '1' && key[0] <= '9') {
+        event = (ButtonHandleEvent)(BTN_1 + (key[0] - '1'));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool parseFreq(const std::string& text, FreqType& freqType)
+{
+    if (text == "315") {
+        freqType = FREQ_315;
+    } else if (text == "433") {
+        freqType = FREQ_433;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static std::vector<std::string> splitWords(const std::string& line)
+{
+    std::vector<std::string> words;
+    size_t pos = 0;
+    while (pos < line.size()) {
+        const size_t start = line.find_first_not_of(" \t\r\n", pos);
+        if (start == std::string::npos) {
+            break;
+        }
+        size_t end = line.find_first_of(" \t\r\n", start);
+        if (end == std::string::npos) {
+            end = line.size();
+        }
+        words.push_back(line.substr(start, end - start));
+        pos = end;
+    }
+    return words;
+}
+
+// 执行一行脚本，出错返回false
+static bool runCommand(const std::vector<std::string>& words)
+{
+    const std::string& command = words[0];
+    if (command == "key" && words.size() >= 2) {
+        for (size_t i = 1; i < words.size(); i++) {
+            ButtonHandleEvent event;
+            if (!parseKey(words[i], event)) {
+                fprintf(stderr, "未知按键: %s\n", words[i].c_str());
+                return false;
+            }
+            if (!buttonHandle.injectEvent(event)) {
+                fprintf(stderr, "按键队列已满\n");
+                return false;
+            }
+            // 过渡期间按键暂缓分发，绘制到队列清空为止
+            do {
+                renderFrame();
+            } while (buttonHandle.hasPendingEvents());
+        }
+        return true;
+    }
+    if (command == "wait" && words.size() == 2) {
+        const long ms = strtol(words[1].c_str(), nullptr, 10);
+        for (long elapsed = 0; elapsed < ms; elapsed += GUI_FRAME_INTERVAL_MS) {
+            renderFrame();
+        }
+        return true;
+    }
+    if (command == "frame" && words.size() == 2) {
+        return dumpFrame(words[1]);
+    }
+    if (command == "rx" && words.size() == 5) {
+        RCData rcData;
+        memset(&rcData, 0, sizeof(rcData));
+        if (!parseFreq(words[1], rcData.freqType)) {
+            return false;
+        }
+        rcData.data = strtoul(words[2].c_str(), nullptr, 16);
+        rcData.bitLength = strtoul(words[3].c_str(), nullptr, 10);
+        rcData.protocal = strtoul(words[4].c_str(), nullptr, 10);
+        HostInjectRadioFrame(rcData);
+        return true;
+    }
+    if (command == "slot" && words.size() >= 7) {
+        RadioData radioData;
+        memset(&radioData.rcData, 0, sizeof(radioData.rcData));
+        if (!parseFreq(words[2], radioData.rcData.freqType)) {
+            return false;
+        }
+        radioData.rcData.data = strtoul(words[3].c_str(), nullptr, 16);
+        radioData.rcData.bitLength = strtoul(words[4].c_str(), nullptr, 10);
+        radioData.rcData.protocal = strtoul(words[5].c_str(), nullptr, 10);
+        radioData.rcData.pulseLength = 350;
+        // 名称可以包含空格
+        std::string name = words[6];
+        for (size_t i = 7; i < words.size(); i++) {
+            name += " " + words[i];
+        }
+        radioData.name = name.c_str();
+        return dataStore.SaveData(atoi(words[1].c_str()), radioData);
+    }
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    const char* scriptPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outputDir = argv[++i];
+        } else if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            goldenDir = argv[++i];
+        } else if (scriptPath == nullptr) {
+            scriptPath = argv[i];
+        } else {
+            fprintf(stderr, "未知参数: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (scriptPath == nullptr) {
+        fprintf(stderr, "用法: ui_headless <脚本> [--out 输出目录] [--golden 基准图像目录]\n");
+        return 2;
+    }
+    FILE* script = fopen(scriptPath, "r");
+    if (script == nullptr) {
+        fprintf(stderr, "无法打开脚本 %s\n", scriptPath);
+        return 2;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(outputDir, error);
+
+    // 手动时钟与空白存储，保证每次运行输出相同的帧
+    HostClockSetManual(true);
+    Preferences::ResetStorage();
+    systemSetting.init(&wifiManager);
+    guiRender.init();
+    uiPageHome.showPage();
+
+    char line[256];
+    int lineNumber = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), script) != nullptr) {
+        lineNumber++;
+        const std::vector<std::string> words = splitWords(line);
+        if (words.empty() || words[0][0] == '#') {
+            continue;
+        }
+        if (!runCommand(words)) {
+            fprintf(stderr, "%s:%d: 命令执行失败: %s", scriptPath, lineNumber, line);
+            ok = false;
+        }
+    }
+    fclose(script);
+
+    printf("绘制 %d 帧，发送 %u 条遥控码\n", frameCount, HostGetSentCount());
+    fflush(stdout);
+    // 与设备上一样不析构全局页面（主页的成员控件也登记在页面的控件列表中，析构会重复释放）
+    _Exit(!ok ? 2 : (mismatchCount > 0 ? 1 : 0));
+}
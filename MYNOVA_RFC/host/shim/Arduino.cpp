@@ -0,0 +1,10 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include <Arduino.h>
+
+HostSerial Serial;
+EspClass ESP;
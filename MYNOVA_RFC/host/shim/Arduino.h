@@ -0,0 +1,191 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "WString.h"
+// 与ESP32核心一样，Arduino.h 已包含FreeRTOS
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+
+/*
+ * 主机构建用的 Arduino 核心替身：计时、串口输出和少量ESP接口，
+ * 使 DataStore、解码器和界面代码可以在Linux上编译运行。
+ */
+
+#define IRAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcpy_P(dest, src, num) memcpy((dest), (src), (num))
+
+#define LOW  0x0
+#define HIGH 0x1
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// 计时默认使用真实时钟；无屏界面构建切换到手动时钟，动画按帧推进，输出的帧与运行速度无关
+struct HostClock {
+    bool manual;
+    uint32_t manualMicros;
+};
+inline HostClock& hostClock()
+{
+    static HostClock clock = { false, 0 };
+    return clock;
+}
+inline void HostClockSetManual(bool manual) { hostClock().manual = manual; }
+inline void HostClockAdvance(uint32_t us) { hostClock().manualMicros += us; }
+
+inline unsigned long micros()
+{
+    if (hostClock().manual) {
+        return hostClock().manualMicros;
+    }
+    static const auto origin = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long ms)
+{
+    if (hostClock().manual) {
+        HostClockAdvance(ms * 1000);
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+inline void delayMicroseconds(unsigned int us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+inline void yield() { std::this_thread::yield(); }
+
+// 主机上没有GPIO，引脚操作为空，中断不会触发
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+inline void attachInterrupt(uint8_t, void (*)(void), int) {}
+inline void detachInterrupt(uint8_t) {}
+
+// 按240MHz折算的周期计数，使基准测试的 cycles -> ns 换算与设备上一致
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+
+inline long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall; }
+inline void randomSeed(unsigned long seed) { srand((unsigned int)seed); }
+
+// Print：与Arduino一样，print/println 最终都经由 write 输出（U8G2 也继承自它）
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size-- > 0) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char* text) { return text != nullptr ? write((const uint8_t*)text, strlen(text)) : 0; }
+    virtual void flush() {}
+
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text) { return write(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int number, int base = DEC) { return print((long)number, base); }
+    size_t print(unsigned int number, int base = DEC) { return print((unsigned long)number, base); }
+    size_t print(long number, int base = DEC)
+    {
+        return (number < 0 && base == DEC) ? write("-") + print((unsigned long)-number, base) : print((unsigned long)number, base);
+    }
+    size_t print(unsigned long number, int base = DEC) { return write(String(number, (unsigned char)base).c_str()); }
+    size_t print(double number, int digits = 2)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", digits, number);
+        return write(buffer);
+    }
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + write("\n"); }
+    template <typename T>
+    size_t println(const T& value, int format) { size_t n = print(value, format); return n + write("\n"); }
+    size_t println() { return write("\n"); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buffer[256];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        return write(buffer);
+    }
+};
+
+// 串口输出到stdout，HOST_SERIAL_QUIET 环境变量非空时丢弃（基准测试只输出结果）
+class HostSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override
+    {
+        static const bool quiet = getenv("HOST_SERIAL_QUIET") != nullptr;
+        if (!quiet) {
+            fwrite(buffer, 1, size, stdout);
+        }
+        return size;
+    }
+    void flush() override { fflush(stdout); }
+};
+extern HostSerial Serial;
+
+// 主机上没有堆统计，返回0；restart() 直接结束进程
+class EspClass
+{
+public:
+    uint32_t getCycleCount()
+    {
+        static const auto origin = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+        return (uint32_t)((uint64_t)ns * getCpuFrequencyMhz() / 1000);
+    }
+    uint32_t getFreeHeap() { return 0; }
+    uint32_t getMinFreeHeap() { return 0; }
+    uint64_t getEfuseMac() { return 0; }
+    void restart() { exit(0); }
+};
+extern EspClass ESP;
+
+#endif
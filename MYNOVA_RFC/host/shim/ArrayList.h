@@ -0,0 +1,27 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_ARRAYLIST_H__
+#define __HOST_ARRAYLIST_H__
+#include <vector>
+
+// ArrayList 库的主机替身，基于 std::vector
+template <typename T>
+class ArrayList
+{
+public:
+    void add(const T& item) { items.push_back(item); }
+    T get(int index) const { return items[index]; }
+    void set(int index, const T& item) { items[index] = item; }
+    void remove(int index) { items.erase(items.begin() + index); }
+    int size() const { return (int)items.size(); }
+    void clear() { items.clear(); }
+
+private:
+    std::vector<T> items;
+};
+
+#endif
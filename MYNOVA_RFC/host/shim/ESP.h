@@ -0,0 +1,11 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_ESP_UPPER_H__
+#define __HOST_ESP_UPPER_H__
+#include "Esp.h"
+
+#endif
@@ -0,0 +1,12 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_ESP_H__
+#define __HOST_ESP_H__
+// ESP 对象在 Arduino.h 中
+#include <Arduino.h>
+
+#endif
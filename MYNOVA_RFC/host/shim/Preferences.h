@@ -0,0 +1,133 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_PREFERENCES_H__
+#define __HOST_PREFERENCES_H__
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+ * 主机构建用的 Preferences 替身：命名空间与键值保存在进程内存中，
+ * 与NVS一样按类型存取，类型不符或键不存在时返回默认值。
+ * 所有实例共享同一份存储，可用 Preferences::ResetStorage() 清空（模拟擦除Flash）。
+ */
+class Preferences
+{
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr)
+    {
+        (void)partitionLabel;
+        if (name == nullptr || strlen(name) > 15) {
+            return false;
+        }
+        space = &storage()[name];
+        readOnlyMode = readOnly;
+        return true;
+    }
+    void end() { space = nullptr; }
+
+    bool clear()
+    {
+        if (!writable()) {
+            return false;
+        }
+        space->clear();
+        return true;
+    }
+    bool remove(const char* key) { return writable() && space->erase(key) > 0; }
+    bool isKey(const char* key) { return space != nullptr && space->count(key) > 0; }
+
+    size_t putBool(const char* key, bool value) { return putValue(key, TYPE_U8, (uint8_t)(value ? 1 : 0)); }
+    size_t putUChar(const char* key, uint8_t value) { return putValue(key, TYPE_U8, value); }
+    size_t putUShort(const char* key, uint16_t value) { return putValue(key, TYPE_U16, value); }
+    size_t putInt(const char* key, int32_t value) { return putValue(key, TYPE_I32, value); }
+    size_t putUInt(const char* key, uint32_t value) { return putValue(key, TYPE_U32, value); }
+    size_t putLong(const char* key, int32_t value) { return putValue(key, TYPE_I32, value); }
+    size_t putString(const char* key, const char* value) { return put(key, TYPE_STR, value, strlen(value)); }
+    size_t putString(const char* key, const String& value) { return put(key, TYPE_STR, value.c_str(), value.length()); }
+    size_t putBytes(const char* key, const void* value, size_t length) { return put(key, TYPE_BLOB, value, length); }
+
+    bool getBool(const char* key, bool defaultValue = false) { return getValue<uint8_t>(key, TYPE_U8, defaultValue ? 1 : 0) != 0; }
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) { return getValue<uint8_t>(key, TYPE_U8, defaultValue); }
+    uint16_t getUShort(const char* key, uint16_t defaultValue = 0) { return getValue<uint16_t>(key, TYPE_U16, defaultValue); }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { return getValue<int32_t>(key, TYPE_I32, defaultValue); }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { return getValue<uint32_t>(key, TYPE_U32, defaultValue); }
+    int32_t getLong(const char* key, int32_t defaultValue = 0) { return getValue<int32_t>(key, TYPE_I32, defaultValue); }
+    String getString(const char* key, const String defaultValue = String())
+    {
+        const Entry* entry = find(key, TYPE_STR);
+        return entry != nullptr ? String(std::string(entry->bytes.begin(), entry->bytes.end())) : defaultValue;
+    }
+    size_t getBytesLength(const char* key)
+    {
+        const Entry* entry = find(key, TYPE_BLOB);
+        return entry != nullptr ? entry->bytes.size() : 0;
+    }
+    size_t getBytes(const char* key, void* buffer, size_t maxLength)
+    {
+        const Entry* entry = find(key, TYPE_BLOB);
+        if (entry == nullptr || entry->bytes.size() > maxLength) {
+            return 0;
+        }
+        memcpy(buffer, entry->bytes.data(), entry->bytes.size());
+        return entry->bytes.size();
+    }
+
+    static void ResetStorage() { storage().clear(); }
+
+private:
+    enum EntryType { TYPE_U8, TYPE_U16, TYPE_I32, TYPE_U32, TYPE_STR, TYPE_BLOB };
+    struct Entry {
+        EntryType type;
+        std::vector<uint8_t> bytes;
+    };
+    typedef std::map<std::string, Entry> Namespace;
+
+    static std::map<std::string, Namespace>& storage()
+    {
+        static std::map<std::string, Namespace> spaces;
+        return spaces;
+    }
+
+    bool writable() const { return space != nullptr && !readOnlyMode; }
+    const Entry* find(const char* key, EntryType type) const
+    {
+        if (space == nullptr) {
+            return nullptr;
+        }
+        Namespace::const_iterator it = space->find(key);
+        return (it != space->end() && it->second.type == type) ? &it->second : nullptr;
+    }
+    size_t put(const char* key, EntryType type, const void* value, size_t length)
+    {
+        if (!writable() || key == nullptr || strlen(key) > 15) {
+            return 0;
+        }
+        Entry& entry = (*space)[key];
+        entry.type = type;
+        entry.bytes.assign((const uint8_t*)value, (const uint8_t*)value + length);
+        return length;
+    }
+    template <typename T>
+    size_t putValue(const char* key, EntryType type, T value) { return put(key, type, &value, sizeof(value)); }
+    template <typename T>
+    T getValue(const char* key, EntryType type, T defaultValue) const
+    {
+        const Entry* entry = find(key, type);
+        T value = defaultValue;
+        if (entry != nullptr && entry->bytes.size() == sizeof(T)) {
+            memcpy(&value, entry->bytes.data(), sizeof(T));
+        }
+        return value;
+    }
+
+    Namespace* space = nullptr;
+    bool readOnlyMode = false;
+};
+
+#endif
@@ -0,0 +1,101 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_WSTRING_H__
+#define __HOST_WSTRING_H__
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+/*
+ * 主机构建用的 Arduino String 替身，只实现固件中用到的接口，底层为 std::string。
+ */
+class String
+{
+public:
+    String() {}
+    String(const char* text) : value(text != nullptr ? text : "") {}
+    String(const std::string& text) : value(text) {}
+    String(char c) : value(1, c) {}
+    String(int number) : value(std::to_string(number)) {}
+    String(unsigned int number) : value(std::to_string(number)) {}
+    String(long number) : value(std::to_string(number)) {}
+    String(unsigned long number) : value(std::to_string(number)) {}
+    String(unsigned long number, unsigned char base) { fromNumber(number, base); }
+    String(unsigned int number, unsigned char base) { fromNumber(number, base); }
+    String(long number, unsigned char base) { fromNumber((unsigned long)number, base); }
+    String(int number, unsigned char base) { fromNumber((unsigned long)number, base); }
+
+    const char* c_str() const { return value.c_str(); }
+    unsigned int length() const { return (unsigned int)value.length(); }
+    bool isEmpty() const { return value.empty(); }
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+    char charAt(unsigned int index) const { return index < value.length() ? value[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    int indexOf(char c, unsigned int from = 0) const
+    {
+        size_t pos = value.find(c, from);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    int indexOf(const String& text, unsigned int from = 0) const
+    {
+        size_t pos = value.find(text.value, from);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    String substring(unsigned int from) const { return from < value.length() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to) {
+            unsigned int t = from;
+            from = to;
+            to = t;
+        }
+        return from < value.length() ? String(value.substr(from, to - from)) : String();
+    }
+    void remove(unsigned int index) { if (index < value.length()) value.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < value.length()) value.erase(index, count); }
+    void toUpperCase() { for (char& c : value) c = (char)toupper((unsigned char)c); }
+    void toLowerCase() { for (char& c : value) c = (char)tolower((unsigned char)c); }
+    void trim()
+    {
+        size_t first = value.find_first_not_of(" \t\r\n");
+        size_t last = value.find_last_not_of(" \t\r\n");
+        value = first == std::string::npos ? std::string() : value.substr(first, last - first + 1);
+    }
+
+    bool equals(const String& other) const { return value == other.value; }
+    bool operator==(const String& other) const { return value == other.value; }
+    bool operator==(const char* text) const { return text != nullptr && value == text; }
+    bool operator!=(const String& other) const { return value != other.value; }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    bool operator<(const String& other) const { return value < other.value; }
+
+    String& operator+=(const String& other) { value += other.value; return *this; }
+    String& operator+=(const char* text) { if (text != nullptr) value += text; return *this; }
+    String& operator+=(char c) { value += c; return *this; }
+    friend String operator+(String left, const String& right) { left += right; return left; }
+    friend String operator+(String left, const char* right) { left += right; return left; }
+    friend String operator+(const char* left, const String& right) { String result(left); result += right; return result; }
+
+private:
+    void fromNumber(unsigned long number, unsigned char base)
+    {
+        if (base < 2 || base > 36) {
+            base = 10;
+        }
+        do {
+            const int digit = (int)(number % base);
+            value.insert(value.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+            number /= base;
+        } while (number > 0);
+    }
+
+    std::string value;
+};
+
+#endif
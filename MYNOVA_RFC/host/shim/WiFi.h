@@ -0,0 +1,50 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_WIFI_H__
+#define __HOST_WIFI_H__
+#include <Arduino.h>
+
+/*
+ * WiFi 库的主机替身：始终处于未连接状态，只提供界面代码用到的接口。
+ */
+
+typedef enum {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class IPAddress
+{
+public:
+    IPAddress() : address{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address{a, b, c, d} {}
+    String toString() const
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", address[0], address[1], address[2], address[3]);
+        return String(text);
+    }
+
+private:
+    uint8_t address[4];
+};
+
+class WiFiClass
+{
+public:
+    wl_status_t status() { return WL_DISCONNECTED; }
+    IPAddress localIP() { return IPAddress(); }
+    IPAddress softAPIP() { return IPAddress(); }
+    String SSID() { return String(); }
+};
+extern WiFiClass WiFi;
+
+#endif
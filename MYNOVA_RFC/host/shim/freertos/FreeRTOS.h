@@ -0,0 +1,44 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+#include <cstdint>
+#include <mutex>
+
+/*
+ * 主机构建用的 FreeRTOS 替身：节拍为1毫秒，信号量与队列基于标准库线程原语实现。
+ */
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// 临界区：主机上用一个全局递归锁代替关中断
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+inline std::recursive_mutex& hostCriticalSection()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+#define portENTER_CRITICAL(mux) hostCriticalSection().lock()
+#define portEXIT_CRITICAL(mux) hostCriticalSection().unlock()
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL(mux) portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux) portEXIT_CRITICAL(mux)
+#define portYIELD_FROM_ISR(...)
+
+#endif
@@ -0,0 +1,93 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_QUEUE_H__
+#define __HOST_QUEUE_H__
+#include "FreeRTOS.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// 定长元素队列：按值复制，超时单位为节拍（1毫秒）
+struct HostQueue {
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue) { delete queue; }
+
+inline bool hostQueueWait(HostQueue* queue, std::unique_lock<std::mutex>& lock, TickType_t ticks, bool (*ready)(HostQueue*))
+{
+    if (ticks == portMAX_DELAY) {
+        queue->changed.wait(lock, [queue, ready] { return ready(queue); });
+        return true;
+    }
+    return queue->changed.wait_for(lock, std::chrono::milliseconds(ticks), [queue, ready] { return ready(queue); });
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!hostQueueWait(queue, lock, ticks, [](HostQueue* q) { return q->items.size() < q->length; })) {
+        return pdFALSE;
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+#define xQueueSendToBack(queue, item, ticks) xQueueSend(queue, item, ticks)
+
+inline BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higherPriorityTaskWoken)
+{
+    if (higherPriorityTaskWoken != nullptr) {
+        *higherPriorityTaskWoken = pdFALSE;
+    }
+    return xQueueSend(queue, item, 0);
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!hostQueueWait(queue, lock, ticks, [](HostQueue* q) { return !q->items.empty(); })) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->items.size();
+}
+
+inline BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->items.clear();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+#endif
@@ -0,0 +1,43 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_SEMPHR_H__
+#define __HOST_SEMPHR_H__
+#include "FreeRTOS.h"
+#include <chrono>
+#include <mutex>
+
+// 互斥信号量：与FreeRTOS一样不可递归，超时单位为节拍（1毫秒）
+struct HostSemaphore {
+    std::timed_mutex mutex;
+};
+typedef HostSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore(); }
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    if (semaphore == nullptr) {
+        return pdFALSE;
+    }
+    if (ticks == portMAX_DELAY) {
+        semaphore->mutex.lock();
+        return pdTRUE;
+    }
+    return semaphore->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore == nullptr) {
+        return pdFALSE;
+    }
+    semaphore->mutex.unlock();
+    return pdTRUE;
+}
+
+#endif
@@ -0,0 +1,48 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_TASK_H__
+#define __HOST_TASK_H__
+#include "FreeRTOS.h"
+#include <chrono>
+#include <thread>
+
+// 主机构建不创建FreeRTOS任务：xTaskCreate 返回失败，任务通知只是计数
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t* handle)
+{
+    if (handle != nullptr) {
+        *handle = nullptr;
+    }
+    return pdFAIL;
+}
+inline void vTaskDelete(TaskHandle_t) {}
+
+inline void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+inline uint32_t& hostTaskNotifications()
+{
+    static uint32_t count = 0;
+    return count;
+}
+inline BaseType_t xTaskNotifyGive(TaskHandle_t) { hostTaskNotifications()++; return pdPASS; }
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t*) { xTaskNotifyGive(task); }
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t)
+{
+    const uint32_t count = hostTaskNotifications();
+    hostTaskNotifications() = clearOnExit ? 0 : (count > 0 ? count - 1 : 0);
+    return count;
+}
+
+inline TickType_t xTaskGetTickCount()
+{
+    static const auto origin = std::chrono::steady_clock::now();
+    return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+#endif
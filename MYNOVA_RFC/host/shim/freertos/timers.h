@@ -0,0 +1,14 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __HOST_TIMERS_H__
+#define __HOST_TIMERS_H__
+#include "FreeRTOS.h"
+
+// 主机构建不使用软件定时器（按键检测器由 host/HostDevices.cpp 替代），只提供句柄类型
+typedef void* TimerHandle_t;
+
+#endif
@@ -24,6 +24,7 @@ ButtonDetector::ButtonDetector(uint8_t button_pin, uint8_t active_level)
     , isPressed_(false)
     , pressStartTime_(0)
     , lastLongPressTime_(0)
+    , eventTimestamp_(0)
     , callback_(nullptr)
     , longPressCallback_(nullptr)
     , debounceTimer_(nullptr)
@@ -139,6 +140,14 @@ uint8_t ButtonDetector::readButtonLevel() const {
     return digitalRead(button_pin_);
 }
 
+/**
+ * @brief 获取当前事件的时间戳
+ * @return 单击为按下中断时刻，长按为本次触发时刻（微秒）
+ */
+uint32_t ButtonDetector::getEventTimestamp() const {
+    return eventTimestamp_;
+}
+
 /**
  * @brief 通过引脚号查找按钮实例
  */
@@ -178,6 +187,7 @@ void IRAM_ATTR ButtonDetector::gpioISR(void* arg) {
         }
         
         btn->isPressed_ = true;
+        btn->eventTimestamp_ = micros();
         btn->pressStartTime_ = millis();
         btn->lastLongPressTime_ = btn->pressStartTime_;
         
@@ -327,6 +337,7 @@ void ButtonDetector::handleLongPressCheck() {
             
             // 触发长按回调前，再次确认按钮状态
             if (longPressCallback_ && readButtonLevel() == active_level_) {
+                eventTimestamp_ = micros();
                 longPressCallback_();
             }
         }
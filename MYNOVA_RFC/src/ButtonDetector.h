@@ -54,6 +54,7 @@ private:
     volatile bool isPressed_;      // 当前是否按下
     volatile uint32_t pressStartTime_;   // 按下开始时间
     volatile uint32_t lastLongPressTime_; // 上次长按触发时间
+    volatile uint32_t eventTimestamp_;   // 当前事件的时间戳（微秒）：单击为按下中断时刻，长按为触发时刻
     
     // 回调函数
     ButtonDetectorCallback callback_;  // 单击回调
@@ -103,6 +104,9 @@ public:
     // 读取按钮电平
     uint8_t readButtonLevel() const;
     
+    // 获取正在回调的事件的时间戳（微秒），在回调中调用
+    uint32_t getEventTimestamp() const;
+    
     // GPIO中断处理函数（静态，IRAM_ATTR）
     static void IRAM_ATTR gpioISR(void* arg);
     static void IRAM_ATTR gpioReleaseISR(void* arg);
@@ -16,13 +16,12 @@ extern SystemSetting systemSetting;
 
 // 全局ButtonHandle实例指针
 ButtonHandle* g_buttonHandle = nullptr;
-TaskHandle_t ButtonHandle::buttonExecuteTaskHandle = nullptr;
 
 ButtonHandle::ButtonHandle()
 {
     g_buttonHandle = this;
-    // 创建队列，最多容纳10个按钮事件
-    buttonEventQueue = xQueueCreate(10, sizeof(ButtonHandleEvent));
+    // 创建队列，事件由渲染任务在两帧之间取出
+    buttonEventQueue = xQueueCreate(BUTTON_EVENT_QUEUE_SIZE, sizeof(ButtonInputEvent));
 }
 
 void ButtonHandle::init()
@@ -100,219 +99,188 @@ void ButtonHandle::init()
     pBtn9->attach(ButtonEvent::LONG_PRESS, Click_Handle_Btn9);  // 长按也触发同样的动作
     pBtn9->start();
 
-    // 创建按钮执行任务（处理按钮事件队列）
-    xTaskCreate(
-        buttonExecuteTask,          // 函数名
-        "ButtonExecuteTask",        // 任务名
-        10240,                       // 任务堆栈大小
-        this,                       // 任务参数
-        5,                          // 任务优先级
-        &buttonExecuteTaskHandle    // 任务句柄
-    );
-
     Serial.println("ButtonHandle init done (GPIO Interrupt Mode)");
 }
 
 // ==================== 按钮中断回调函数 ====================
 // 这些函数在消抖完成后被调用，将事件放入队列
 
+// 事件带上按下时刻的时间戳放入队列，并唤醒渲染任务在下一帧前处理
+void ButtonHandle::queueEvent(ButtonHandleEvent button, ButtonDetector* detector)
+{
+    ButtonInputEvent event;
+    event.button = button;
+    event.timestamp = detector->getEventTimestamp();
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
+    uiEngine.requestRedrawFromISR(&xHigherPriorityTaskWoken);
+    if (xHigherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 void ButtonHandle::Click_Handle_BtnBack()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_BACK;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_BACK, g_buttonHandle->pBtnBack);
     }
 }
 
 void ButtonHandle::Click_Handle_BtnMenu()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_MENU;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_MENU, g_buttonHandle->pBtnMenu);
     }
 }
 
 void ButtonHandle::Click_Handle_BtnEnter()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_ENTER;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_ENTER, g_buttonHandle->pBtnEnter);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn1()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_1;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_1, g_buttonHandle->pBtn1);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn2()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_2;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_2, g_buttonHandle->pBtn2);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn3()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_3;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_3, g_buttonHandle->pBtn3);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn4()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_4;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_4, g_buttonHandle->pBtn4);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn5()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_5;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_5, g_buttonHandle->pBtn5);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn6()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_6;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_6, g_buttonHandle->pBtn6);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn7()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_7;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_7, g_buttonHandle->pBtn7);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn8()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_8;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
+        queueEvent(BTN_8, g_buttonHandle->pBtn8);
     }
 }
 
 void ButtonHandle::Click_Handle_Btn9()
 {
     if (g_buttonHandle) {
-        ButtonHandleEvent event = BTN_9;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(g_buttonHandle->buttonEventQueue, &event, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
+        queueEvent(BTN_9, g_buttonHandle->pBtn9);
+    }
+}
+
+bool ButtonHandle::injectEvent(ButtonHandleEvent button)
+{
+    ButtonInputEvent event;
+    event.button = button;
+    event.timestamp = micros();
+    if (xQueueSend(buttonEventQueue, &event, 0) != pdPASS) {
+        return false;
+    }
+    uiEngine.requestRedraw();
+    return true;
+}
+
+// ==================== 按钮事件分发 ====================
+// 由渲染任务在两帧之间调用，页面状态只在渲染任务中修改，无需加锁
+
+int ButtonHandle::processEvents(uint32_t* timestamps, int maxTimestamps)
+{
+    ButtonInputEvent event;
+    int count = 0;
+    // 某个事件触发了带动画的页面跳转后立即停止，后续按键不能发给旧页面
+    while (!uiEngine.isTransitioning() && xQueueReceive(buttonEventQueue, &event, 0) == pdPASS) {
+        dispatchEvent(event.button);
+        if (count < maxTimestamps) {
+            timestamps[count++] = event.timestamp;
         }
     }
+    return count;
 }
 
-// ==================== 按钮事件执行任务 ====================
-// 从队列中取出事件并分发给对应的页面处理
+bool ButtonHandle::hasPendingEvents()
+{
+    return uxQueueMessagesWaiting(buttonEventQueue) > 0;
+}
 
-void ButtonHandle::buttonExecuteTask(void* pvParameters)
+void ButtonHandle::dispatchEvent(ButtonHandleEvent event)
 {
-    ButtonHandleEvent event;
-    while(true){
-        // 等待队列中接收消息
-        if (g_buttonHandle && xQueueReceive(g_buttonHandle->buttonEventQueue, &event, portMAX_DELAY) == pdPASS) {
-            // 任何按键按下都重置空闲计时器
-            systemSetting.resetIdleTimer();
-            
-            UIPage* currentPage = uiEngine.getCurrentPage();
-            if (currentPage) {
-                switch (event) {
-                    case BTN_BACK:
-                        currentPage->onButtonBack();
-                        break;
-                    case BTN_MENU:
-                        currentPage->onButtonMenu();
-                        break;
-                    case BTN_ENTER:
-                        currentPage->onButtonEnter();
-                        break;
-                    case BTN_1:
-                        currentPage->onButton1();
-                        break;
-                    case BTN_2:
-                        currentPage->onButton2();
-                        break;
-                    case BTN_3:
-                        currentPage->onButton3();
-                        break;
-                    case BTN_4:
-                        currentPage->onButton4();
-                        break;
-                    case BTN_5:
-                        currentPage->onButton5();
-                        break;
-                    case BTN_6:
-                        currentPage->onButton6();
-                        break;
-                    case BTN_7:
-                        currentPage->onButton7();
-                        break;
-                    case BTN_8:
-                        currentPage->onButton8();
-                        break;
-                    case BTN_9:
-                        currentPage->onButton9();
-                        break;
-                }
-            }
+    // 任何按键按下都重置空闲计时器
+    systemSetting.resetIdleTimer();
+    
+    UIPage* currentPage = uiEngine.getCurrentPage();
+    if (currentPage) {
+        switch (event) {
+            case BTN_BACK:
+                currentPage->onButtonBack();
+                break;
+            case BTN_MENU:
+                currentPage->onButtonMenu();
+                break;
+            case BTN_ENTER:
+                currentPage->onButtonEnter();
+                break;
+            case BTN_1:
+                currentPage->onButton1();
+                break;
+            case BTN_2:
+                currentPage->onButton2();
+                break;
+            case BTN_3:
+                currentPage->onButton3();
+                break;
+            case BTN_4:
+                currentPage->onButton4();
+                break;
+            case BTN_5:
+                currentPage->onButton5();
+                break;
+            case BTN_6:
+                currentPage->onButton6();
+                break;
+            case BTN_7:
+                currentPage->onButton7();
+                break;
+            case BTN_8:
+                currentPage->onButton8();
+                break;
+            case BTN_9:
+                currentPage->onButton9();
+                break;
         }
     }
 }
@@ -345,11 +313,6 @@ ButtonHandle::~ButtonHandle()
     if(pBtn9 != NULL)
         delete pBtn9;
 
-    // 删除按钮执行任务
-    if (buttonExecuteTaskHandle != NULL) {
-        vTaskDelete(buttonExecuteTaskHandle);
-    }
-    
     // 删除队列
     if (buttonEventQueue != NULL) {
         vQueueDelete(buttonEventQueue);
@@ -27,12 +27,27 @@ enum ButtonHandleEvent {
     BTN_9
 };
 
+// 按钮事件队列长度
+#define BUTTON_EVENT_QUEUE_SIZE 10
+
+// 队列中的按键事件：时间戳为按下时刻（微秒），用于统计按键到屏幕显示的延迟
+struct ButtonInputEvent {
+    ButtonHandleEvent button;
+    uint32_t timestamp;
+};
+
 class ButtonHandle
 {
 public:
     ButtonHandle();
     ~ButtonHandle();
     void init();
+    // 注入按键事件（与实体按键走同一个队列），用于远程脚本化操作界面
+    bool injectEvent(ButtonHandleEvent button);
+    // 在渲染任务中两帧之间调用：分发队列中的事件，返回记录的事件时间戳数量
+    // 页面过渡期间暂停分发，剩余事件留在队列中，等新页面成为当前页面后再分发
+    int processEvents(uint32_t* timestamps, int maxTimestamps);
+    bool hasPendingEvents();
     
 private:
     // 按钮中断回调函数（无需参数）
@@ -48,6 +63,8 @@ private:
     static void Click_Handle_Btn7();
     static void Click_Handle_Btn8();
     static void Click_Handle_Btn9();
+    static void queueEvent(ButtonHandleEvent button, ButtonDetector* detector);
+    void dispatchEvent(ButtonHandleEvent event);
  
 private:
     // 按钮检测器实例
@@ -64,14 +81,8 @@ private:
     ButtonDetector* pBtn8;
     ButtonDetector* pBtn9;
     
-    // 按钮事件队列
+    // 按钮事件队列（ButtonInputEvent）
     QueueHandle_t buttonEventQueue;
-    
-    // FreeRTOS任务句柄（只需要执行任务）
-    static TaskHandle_t buttonExecuteTaskHandle;
-    
-    // 按钮事件处理任务函数
-    static void buttonExecuteTask(void* pvParameters);
 };
 
 #endif
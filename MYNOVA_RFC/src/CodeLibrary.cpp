@@ -0,0 +1,490 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "CodeLibrary.h"
+
+#define LOG_MAGIC       0x474F4C43      // "CLOG"
+#define INDEX_MAGIC     0x58444943      // "CIDX"
+#define RECORD_MAGIC    0xC0DE
+#define LIBRARY_VERSION 1
+#define EMPTY_OFFSET    0xFFFFFFFFUL
+
+// 码库使用独立的数据分区，网页资源所在的spiffs分区被文件系统OTA整体改写时不受影响
+static fs::LittleFSFS codeFS;
+
+// FNV-1a，用于检测掉电造成的半条记录和损坏的快照
+static uint32_t checksum(const void* data, size_t length, uint32_t hash = 2166136261UL)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static uint32_t recordChecksum(uint16_t slot, const RadioRecord& record)
+{
+    return checksum(&record, sizeof(record), checksum(&slot, sizeof(slot)));
+}
+
+CodeLibrary::CodeLibrary():
+keys(nullptr),
+offsets(nullptr),
+newOffsets(nullptr),
+slotCount(0),
+created(false),
+generation(0),
+logLength(0),
+logRecords(0),
+liveRecords(0),
+recordsSinceSnapshot(0),
+compacting(false),
+compactCursor(0),
+compactLength(0),
+compactRecords(0)
+{
+}
+
+CodeLibrary::~CodeLibrary()
+{
+    closeReader();
+    delete[] offsets;
+    delete[] newOffsets;
+}
+
+bool CodeLibrary::Begin(SlotKey* slotKeys, int count, bool allowFormat)
+{
+    keys = slotKeys;
+    created = false;
+    compacting = false;
+    closeReader();
+    slotCount = count;
+    if (offsets == nullptr) {
+        offsets = new uint32_t[slotCount];
+    }
+    for (int i = 0; i < slotCount; i++) {
+        offsets[i] = EMPTY_OFFSET;
+    }
+    memset(keys, 0, sizeof(SlotKey) * slotCount);
+
+    // 挂载失败时只在调用者允许时格式化（分区从未建立过码库），已有码库的分区不会被清空
+    if (!codeFS.begin(false, CODE_LIBRARY_MOUNT, 5, CODE_LIBRARY_PARTITION)) {
+        if (!allowFormat) {
+            Serial.println("CodeLibrary: 码库分区挂载失败，保留分区内容不格式化");
+            return false;
+        }
+        Serial.println("CodeLibrary: 码库分区未初始化，格式化");
+        if (!codeFS.format() || !codeFS.begin(false, CODE_LIBRARY_MOUNT, 5, CODE_LIBRARY_PARTITION)) {
+            Serial.println("CodeLibrary: 码库分区挂载失败");
+            return false;
+        }
+    }
+    if (!codeFS.exists(CODE_LIBRARY_DIR)) {
+        codeFS.mkdir(CODE_LIBRARY_DIR);
+    }
+
+    // 压缩在删除旧日志后、改名前掉电：新日志已完整，直接启用
+    if (!codeFS.exists(CODE_LIBRARY_LOG) && codeFS.exists(CODE_LIBRARY_LOG_TMP)) {
+        codeFS.rename(CODE_LIBRARY_LOG_TMP, CODE_LIBRARY_LOG);
+    }
+    codeFS.remove(CODE_LIBRARY_LOG_TMP);
+
+    if (!codeFS.exists(CODE_LIBRARY_LOG)) {
+        created = true;
+        return createLog(CODE_LIBRARY_LOG, 1);
+    }
+
+    File file = codeFS.open(CODE_LIBRARY_LOG, "r");
+    LogHeader header;
+    if (!file || file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != LOG_MAGIC || header.version != LIBRARY_VERSION || header.recordSize != sizeof(LogRecord)) {
+        Serial.println("CodeLibrary: 日志文件无效，重新创建");
+        file.close();
+        created = true;
+        return createLog(CODE_LIBRARY_LOG, 1);
+    }
+    generation = header.generation;
+
+    const uint32_t fileSize = file.size();
+    uint32_t replayFrom = sizeof(LogHeader);
+    if (loadSnapshot(fileSize)) {
+        replayFrom = logLength;
+    } else {
+        Serial.println("CodeLibrary: 无可用索引快照，扫描整个日志");
+        for (int i = 0; i < slotCount; i++) {
+            offsets[i] = EMPTY_OFFSET;
+        }
+        memset(keys, 0, sizeof(SlotKey) * slotCount);
+        liveRecords = 0;
+        logRecords = 0;
+    }
+
+    const uint32_t replayed = replayLog(file, replayFrom, fileSize);
+    file.close();
+
+    Serial.print("CodeLibrary: 已加载，有效: ");
+    Serial.print(liveRecords);
+    Serial.print(" 日志记录: ");
+    Serial.print(logRecords);
+    Serial.print(" 重放: ");
+    Serial.println(replayed);
+
+    if (logLength < fileSize) {
+        // 末尾有掉电写坏的半条记录，之后追加的记录会在下次启动时被它挡住，立即压缩重写
+        Serial.println("CodeLibrary: 日志末尾损坏，立即压缩");
+        startCompaction();
+        while (compacting) {
+            compactStep();
+        }
+    } else if (replayed >= CODE_LIBRARY_SNAPSHOT_INTERVAL) {
+        writeSnapshot();
+    }
+    return true;
+}
+
+bool CodeLibrary::IsCreated()
+{
+    return created;
+}
+
+bool CodeLibrary::createLog(const char* path, uint32_t newGeneration)
+{
+    File file = codeFS.open(path, "w");
+    if (!file) {
+        Serial.println("CodeLibrary: 创建日志失败");
+        return false;
+    }
+    LogHeader header = { LOG_MAGIC, LIBRARY_VERSION, sizeof(LogRecord), newGeneration };
+    const bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    file.close();
+
+    if (strcmp(path, CODE_LIBRARY_LOG) == 0) {
+        generation = newGeneration;
+        logLength = sizeof(LogHeader);
+        logRecords = 0;
+        liveRecords = 0;
+        recordsSinceSnapshot = 0;
+        codeFS.remove(CODE_LIBRARY_INDEX);
+    }
+    return ok;
+}
+
+bool CodeLibrary::loadSnapshot(uint32_t fileSize)
+{
+    File file = codeFS.open(CODE_LIBRARY_INDEX, "r");
+    if (!file) {
+        return false;
+    }
+    IndexHeader header;
+    bool ok = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+              header.magic == INDEX_MAGIC && header.version == LIBRARY_VERSION &&
+              header.slotCount == slotCount && header.generation == generation &&
+              header.coveredLength >= sizeof(LogHeader) && header.coveredLength <= fileSize;
+    if (ok) {
+        ok = file.read((uint8_t*)offsets, sizeof(uint32_t) * slotCount) == sizeof(uint32_t) * slotCount &&
+             file.read((uint8_t*)keys, sizeof(SlotKey) * slotCount) == sizeof(SlotKey) * slotCount &&
+             checksum(keys, sizeof(SlotKey) * slotCount, checksum(offsets, sizeof(uint32_t) * slotCount)) == header.checksum;
+    }
+    file.close();
+    if (!ok) {
+        return false;
+    }
+
+    logLength = header.coveredLength;
+    logRecords = (header.coveredLength - sizeof(LogHeader)) / sizeof(LogRecord);
+    liveRecords = 0;
+    for (int i = 0; i < slotCount; i++) {
+        if (offsets[i] != EMPTY_OFFSET) {
+            liveRecords++;
+        }
+    }
+    recordsSinceSnapshot = 0;
+    return true;
+}
+
+bool CodeLibrary::writeSnapshot()
+{
+    IndexHeader header;
+    header.magic = INDEX_MAGIC;
+    header.version = LIBRARY_VERSION;
+    header.slotCount = slotCount;
+    header.generation = generation;
+    header.coveredLength = logLength;
+    header.checksum = checksum(keys, sizeof(SlotKey) * slotCount, checksum(offsets, sizeof(uint32_t) * slotCount));
+
+    File file = codeFS.open(CODE_LIBRARY_INDEX_TMP, "w");
+    if (!file) {
+        return false;
+    }
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+              file.write((const uint8_t*)offsets, sizeof(uint32_t) * slotCount) == sizeof(uint32_t) * slotCount &&
+              file.write((const uint8_t*)keys, sizeof(SlotKey) * slotCount) == sizeof(SlotKey) * slotCount;
+    file.close();
+
+    // 先写临时文件再改名，掉电时旧快照仍然完整
+    if (ok) {
+        codeFS.remove(CODE_LIBRARY_INDEX);
+        ok = codeFS.rename(CODE_LIBRARY_INDEX_TMP, CODE_LIBRARY_INDEX);
+    }
+    if (ok) {
+        recordsSinceSnapshot = 0;
+    }
+    return ok;
+}
+
+// 从 from 开始顺序应用日志记录，遇到无效记录即停止，返回应用的记录数
+uint32_t CodeLibrary::replayLog(File& file, uint32_t from, uint32_t fileSize)
+{
+    uint32_t replayed = 0;
+    uint32_t position = from;
+    file.seek(position);
+
+    LogRecord entry;
+    while (position + sizeof(LogRecord) <= fileSize) {
+        if (file.read((uint8_t*)&entry, sizeof(entry)) != sizeof(entry) ||
+            entry.magic != RECORD_MAGIC || entry.slot < 1 || entry.slot > slotCount ||
+            entry.checksum != recordChecksum(entry.slot, entry.record)) {
+            break;
+        }
+
+        const int i = entry.slot - 1;
+        const bool wasLive = offsets[i] != EMPTY_OFFSET;
+        if (entry.record.nameLength > 0) {
+            offsets[i] = position;
+            if (!wasLive) {
+                liveRecords++;
+            }
+        } else {
+            offsets[i] = EMPTY_OFFSET;
+            if (wasLive) {
+                liveRecords--;
+            }
+        }
+        setKey(entry.slot, entry.record);
+
+        position += sizeof(LogRecord);
+        logRecords++;
+        replayed++;
+    }
+    logLength = position;
+    recordsSinceSnapshot += replayed;
+    return replayed;
+}
+
+void CodeLibrary::setKey(int index, const RadioRecord& record)
+{
+    SlotKey& key = keys[index - 1];
+    key.data = record.data;
+    key.freqType = record.freqType;
+    key.protocol = record.protocol;
+    key.bitLength = record.bitLength;
+    key.used = record.nameLength > 0 ? 1 : 0;
+}
+
+bool CodeLibrary::appendRecord(File& file, uint32_t position, int index, const RadioRecord& record)
+{
+    LogRecord entry;
+    entry.magic = RECORD_MAGIC;
+    entry.slot = (uint16_t)index;
+    entry.record = record;
+    entry.checksum = recordChecksum(entry.slot, entry.record);
+
+    if (!file.seek(position)) {
+        return false;
+    }
+    return file.write((const uint8_t*)&entry, sizeof(entry)) == sizeof(entry);
+}
+
+void CodeLibrary::closeReader()
+{
+    if (reader) {
+        reader.close();
+    }
+}
+
+bool CodeLibrary::readRecord(uint32_t offset, int index, RadioRecord& record)
+{
+    if (!reader) {
+        reader = codeFS.open(CODE_LIBRARY_LOG, "r");
+        if (!reader) {
+            return false;
+        }
+    }
+    LogRecord entry;
+    if (!reader.seek(offset) || reader.read((uint8_t*)&entry, sizeof(entry)) != sizeof(entry)) {
+        return false;
+    }
+    if (entry.magic != RECORD_MAGIC || entry.slot != index ||
+        entry.checksum != recordChecksum(entry.slot, entry.record)) {
+        Serial.print("CodeLibrary: 记录校验失败，槽位: ");
+        Serial.println(index);
+        return false;
+    }
+    record = entry.record;
+    return true;
+}
+
+bool CodeLibrary::Read(int index, RadioRecord& record)
+{
+    if (offsets == nullptr || index < 1 || index > slotCount || offsets[index - 1] == EMPTY_OFFSET) {
+        return false;
+    }
+    return readRecord(offsets[index - 1], index, record);
+}
+
+bool CodeLibrary::Write(int index, const RadioRecord& record)
+{
+    if (offsets == nullptr || index < 1 || index > slotCount) {
+        return false;
+    }
+    const bool wasLive = offsets[index - 1] != EMPTY_OFFSET;
+    const bool live = record.nameLength > 0;
+    if (!wasLive && !live) {
+        return true;
+    }
+
+    // 追加写用 "r+" 打开，按记录的逻辑长度定位，不依赖文件末尾
+    closeReader();
+    File file = codeFS.open(CODE_LIBRARY_LOG, "r+");
+    if (!file || !appendRecord(file, logLength, index, record)) {
+        Serial.println("CodeLibrary: 写入日志失败");
+        file.close();
+        return false;
+    }
+    file.close();
+
+    offsets[index - 1] = live ? logLength : EMPTY_OFFSET;
+    logLength += sizeof(LogRecord);
+    logRecords++;
+    recordsSinceSnapshot++;
+    if (live && !wasLive) {
+        liveRecords++;
+    } else if (!live && wasLive) {
+        liveRecords--;
+    }
+    setKey(index, record);
+
+    // 压缩中：已搬运过的槽位同时写入新日志，未搬运的稍后会带上最新内容
+    if (compacting && index - 1 < compactCursor) {
+        File tmp = codeFS.open(CODE_LIBRARY_LOG_TMP, "r+");
+        if (tmp && appendRecord(tmp, compactLength, index, record)) {
+            newOffsets[index - 1] = live ? compactLength : EMPTY_OFFSET;
+            compactLength += sizeof(LogRecord);
+            compactRecords++;
+        } else {
+            // 新日志写入失败则放弃本次压缩，旧日志仍然完整
+            compacting = false;
+            codeFS.remove(CODE_LIBRARY_LOG_TMP);
+        }
+        tmp.close();
+    }
+    return true;
+}
+
+bool CodeLibrary::Clear()
+{
+    closeReader();
+    compacting = false;
+    codeFS.remove(CODE_LIBRARY_LOG_TMP);
+    for (int i = 0; i < slotCount; i++) {
+        offsets[i] = EMPTY_OFFSET;
+    }
+    memset(keys, 0, sizeof(SlotKey) * slotCount);
+    return createLog(CODE_LIBRARY_LOG, generation + 1);
+}
+
+void CodeLibrary::Update()
+{
+    if (offsets == nullptr) {
+        return;
+    }
+    if (compacting) {
+        compactStep();
+    } else if (logRecords > liveRecords * 2 + CODE_LIBRARY_COMPACT_SLACK) {
+        startCompaction();
+    } else if (recordsSinceSnapshot >= CODE_LIBRARY_SNAPSHOT_INTERVAL) {
+        writeSnapshot();
+    }
+}
+
+void CodeLibrary::startCompaction()
+{
+    if (newOffsets == nullptr) {
+        newOffsets = new uint32_t[slotCount];
+    }
+    if (!createLog(CODE_LIBRARY_LOG_TMP, generation + 1)) {
+        return;
+    }
+    for (int i = 0; i < slotCount; i++) {
+        newOffsets[i] = EMPTY_OFFSET;
+    }
+    compactCursor = 0;
+    compactLength = sizeof(LogHeader);
+    compactRecords = 0;
+    compacting = true;
+    Serial.print("CodeLibrary: 开始压缩，日志记录: ");
+    Serial.print(logRecords);
+    Serial.print(" 有效: ");
+    Serial.println(liveRecords);
+}
+
+void CodeLibrary::compactStep()
+{
+    File tmp = codeFS.open(CODE_LIBRARY_LOG_TMP, "r+");
+    if (!tmp) {
+        compacting = false;
+        return;
+    }
+
+    int moved = 0;
+    while (compactCursor < slotCount && moved < CODE_LIBRARY_COMPACT_STEP) {
+        const int index = compactCursor + 1;
+        RadioRecord record;
+        if (offsets[compactCursor] != EMPTY_OFFSET) {
+            if (!readRecord(offsets[compactCursor], index, record) ||
+                !appendRecord(tmp, compactLength, index, record)) {
+                Serial.println("CodeLibrary: 压缩失败，保留旧日志");
+                tmp.close();
+                compacting = false;
+                codeFS.remove(CODE_LIBRARY_LOG_TMP);
+                return;
+            }
+            newOffsets[compactCursor] = compactLength;
+            compactLength += sizeof(LogRecord);
+            compactRecords++;
+            moved++;
+        }
+        compactCursor++;
+    }
+    tmp.close();
+
+    if (compactCursor >= slotCount) {
+        finishCompaction();
+    }
+}
+
+void CodeLibrary::finishCompaction()
+{
+    closeReader();
+    codeFS.remove(CODE_LIBRARY_LOG);
+    if (!codeFS.rename(CODE_LIBRARY_LOG_TMP, CODE_LIBRARY_LOG)) {
+        // 下次启动会从临时文件恢复
+        Serial.println("CodeLibrary: 日志改名失败");
+    }
+
+    uint32_t* swap = offsets;
+    offsets = newOffsets;
+    newOffsets = swap;
+    generation++;
+    logLength = compactLength;
+    logRecords = compactRecords;
+    compacting = false;
+    writeSnapshot();
+
+    Serial.print("CodeLibrary: 压缩完成，日志记录: ");
+    Serial.println(logRecords);
+}
@@ -0,0 +1,108 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef CODELIBRARY_H
+#define CODELIBRARY_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "DataStore.h"
+
+// 码库所在的数据分区（partitions.csv 中的 codelib）及挂载点
+#define CODE_LIBRARY_PARTITION  "codelib"
+#define CODE_LIBRARY_MOUNT      "/codelib"
+
+#define CODE_LIBRARY_DIR        "/codelib"
+#define CODE_LIBRARY_LOG        CODE_LIBRARY_DIR "/records.log"
+#define CODE_LIBRARY_LOG_TMP    CODE_LIBRARY_DIR "/records.tmp"
+#define CODE_LIBRARY_INDEX      CODE_LIBRARY_DIR "/index.bin"
+#define CODE_LIBRARY_INDEX_TMP  CODE_LIBRARY_DIR "/index.tmp"
+
+// 距上次索引快照追加的记录数达到该值时重写快照，限制启动时需要重放的日志长度
+#define CODE_LIBRARY_SNAPSHOT_INTERVAL 64
+// 失效记录数超过有效记录数加上该值时开始压缩
+#define CODE_LIBRARY_COMPACT_SLACK 64
+// 每次 Update() 压缩搬运的槽位数，避免长时间占用存储锁
+#define CODE_LIBRARY_COMPACT_STEP 32
+
+/*
+ * 独立LittleFS分区上的追加式遥控码库。
+ * 每次写入（包括删除）都在日志末尾追加一条定长记录，内存中只保存
+ * 槽位 -> 文件偏移 的索引，读取一个槽位只需一次定位读。
+ * 索引定期写成快照文件，启动时读取快照并只重放快照之后追加的日志，
+ * 不需要扫描整个日志。失效记录由 Update() 分步压缩回收。
+ * 所有方法都不加锁，由 DataStore 在持有存储互斥锁时调用。
+ */
+class CodeLibrary
+{
+public:
+    CodeLibrary();
+    ~CodeLibrary();
+
+    // 打开或创建码库并加载索引，keys 由调用者提供（slotCount 个），返回后已填好
+    // allowFormat：分区无法挂载时是否允许格式化（只应在分区从未建立过码库时为true）
+    bool Begin(SlotKey* keys, int slotCount, bool allowFormat);
+    bool IsCreated();                            // 本次启动新建的码库（可从NVS导入）
+    bool Read(int index, RadioRecord& record);
+    bool Write(int index, const RadioRecord& record);   // nameLength为0表示删除
+    bool Clear();
+    void Update();                               // 分步压缩、写索引快照
+
+private:
+    struct __attribute__((packed)) LogHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t recordSize;
+        uint32_t generation;
+    };
+    struct __attribute__((packed)) LogRecord {
+        uint16_t magic;
+        uint16_t slot;
+        uint32_t checksum;
+        RadioRecord record;
+    };
+    struct __attribute__((packed)) IndexHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t slotCount;
+        uint32_t generation;
+        uint32_t coveredLength;                  // 快照覆盖到的日志长度
+        uint32_t checksum;
+    };
+
+    bool createLog(const char* path, uint32_t generation);
+    bool loadSnapshot(uint32_t fileSize);
+    bool writeSnapshot();
+    uint32_t replayLog(File& file, uint32_t from, uint32_t fileSize);
+    bool appendRecord(File& file, uint32_t position, int index, const RadioRecord& record);
+    bool readRecord(uint32_t offset, int index, RadioRecord& record);
+    void setKey(int index, const RadioRecord& record);
+    void closeReader();
+    void startCompaction();
+    void compactStep();
+    void finishCompaction();
+
+    SlotKey* keys;
+    uint32_t* offsets;                           // 槽位 -> 日志偏移，EMPTY_OFFSET表示空
+    uint32_t* newOffsets;                        // 压缩中：槽位 -> 新日志偏移
+    int slotCount;
+    bool created;
+
+    uint32_t generation;
+    uint32_t logLength;                          // 有效日志长度（下一条记录的写入位置）
+    uint32_t logRecords;                         // 日志中的记录总数（含失效记录）
+    uint32_t liveRecords;                        // 有效槽位数
+    uint32_t recordsSinceSnapshot;
+
+    bool compacting;
+    int compactCursor;                           // 压缩中：下一个要搬运的槽位（从0开始）
+    uint32_t compactLength;
+    uint32_t compactRecords;
+
+    File reader;                                 // 常驻读句柄，写入后重新打开
+};
+
+#endif
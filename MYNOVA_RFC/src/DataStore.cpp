@@ -6,8 +6,14 @@
 
 #include "DataStore.h"
 #include <Preferences.h>
+#if DATASTORE_USE_LITTLEFS
+#include "CodeLibrary.h"
+#endif
 
 Preferences preferences;
+#if DATASTORE_USE_LITTLEFS
+static CodeLibrary codeLibrary;
+#endif
 
 #define KEY_NAMESPACE   "RadioData"
 #define KEY_NAME        "NAME"
@@ -16,6 +22,11 @@ Preferences preferences;
 #define KEY_BITLENGTH   "BLENGTH"
 #define KEY_PULSELENGTH "PLENGTH"
 #define KEY_PROTOCAL    "PROTOCOL"
+#define KEY_RECORD      "REC"
+#define KEY_RECORD_VERSION "REC_VER"
+#define KEY_CODELIB_READY  "CODELIB_OK"   // 码库分区已建立过码库，之后挂载失败不再格式化
+// NVS中保存的槽位数上限（旧格式与NVS后端）
+#define NVS_RECORD_SLOT_COUNT 100
 #define KEY_QUICKKEY    "QUICKKEY"
 #define KEY_QUICKKEY_1  "QKEY_1"
 #define KEY_QUICKKEY_2  "QKEY_2"
@@ -65,13 +76,24 @@ static MQTTMode stringToMQTTMode(const String& mode) {
 #define MQTT_KEY_USERNAME "username"
 #define MQTT_KEY_PASSWORD "password"
 
-DataStore::DataStore()
+DataStore::DataStore():
+slotCacheLoaded(false),
+lastJobId(0),
+finishedJobId(0),
+failedJobBits(0)
 {
+#if !DATASTORE_USE_LITTLEFS
+    memset(slotRecords, 0, sizeof(slotRecords));
+#endif
+    memset(slotKeys, 0, sizeof(slotKeys));
+    memset(slotBitmap, 0, sizeof(slotBitmap));
+    memset(codeIndex, 0, sizeof(codeIndex));
     // 创建互斥锁，并检查是否创建成功
     preferencesMutex = xSemaphoreCreateMutex();
     if (preferencesMutex == nullptr) {
         Serial.println("DataStore: 互斥锁创建失败!");
     }
+    jobQueue = xQueueCreate(DATASTORE_JOB_QUEUE_SIZE, sizeof(StoreJob));
 }
 
 DataStore::~DataStore()
@@ -83,109 +105,397 @@ DataStore::~DataStore()
     }
 }
 
-void DataStore::SaveData(int index, RadioData radioData)
+// 构造槽位记录键名，例如 "REC_12"
+static void makeRecordKey(char* key, int index)
+{
+    sprintf(key, KEY_RECORD "_%d", index);
+}
+
+// 构造旧格式键名，例如 "NAME_12"
+static void makeLegacyKey(char* key, const char* prefix, int index)
+{
+    sprintf(key, "%s_%d", prefix, index);
+}
+
+static void packRecord(const RadioData& radioData, RadioRecord& record)
+{
+    memset(&record, 0, sizeof(record));
+    record.version = RADIO_RECORD_VERSION;
+    record.freqType = (uint8_t)radioData.rcData.freqType;
+    record.protocol = (uint8_t)radioData.rcData.protocal;
+    record.bitLength = (uint8_t)radioData.rcData.bitLength;
+    record.pulseLength = radioData.rcData.pulseLength;
+    record.data = (uint32_t)radioData.rcData.data;
+
+    // RadioName 已保证不超过 RADIO_NAME_MAX_BYTES 且在字符边界截断
+    memcpy(record.name, radioData.name.c_str(), radioData.name.length());
+    record.nameLength = (uint8_t)radioData.name.length();
+}
+
+static void unpackRecord(const RadioRecord& record, RadioData& radioData)
+{
+    const size_t length = (record.nameLength > RADIO_NAME_MAX_BYTES) ? RADIO_NAME_MAX_BYTES : record.nameLength;
+    radioData.name.assign(record.name, length);
+    radioData.rcData.freqType = (FreqType)record.freqType;
+    radioData.rcData.protocal = record.protocol;
+    radioData.rcData.bitLength = record.bitLength;
+    radioData.rcData.pulseLength = record.pulseLength;
+    radioData.rcData.data = record.data;
+}
+
+static void makeSlotKey(const RadioRecord& record, SlotKey& key)
+{
+    key.data = record.data;
+    key.freqType = record.freqType;
+    key.protocol = record.protocol;
+    key.bitLength = record.bitLength;
+    key.used = record.nameLength > 0 ? 1 : 0;
+}
+
+// 加载全部槽位到内存（必要时先迁移旧格式），需在持有互斥锁时调用
+void DataStore::ensureSlotCache()
+{
+    if (slotCacheLoaded) {
+        return;
+    }
+
+    preferences.begin(KEY_NAMESPACE);
+    if (preferences.getUChar(KEY_RECORD_VERSION, 0) != RADIO_RECORD_VERSION) {
+        // 有槽位迁移失败时不写版本号，旧键保留，下次启动继续迁移
+        if (migrateLegacyData()) {
+            preferences.putUChar(KEY_RECORD_VERSION, RADIO_RECORD_VERSION);
+        }
+    }
+
+    memset(slotBitmap, 0, sizeof(slotBitmap));
+    char recordKey[16];
+    int count = 0;
+#if DATASTORE_USE_LITTLEFS
+    // 码库加载时直接从索引快照恢复各槽位的编码摘要，不读取记录本身
+    const bool libraryReady = preferences.getBool(KEY_CODELIB_READY, false);
+    if (!codeLibrary.Begin(slotKeys, RADIO_DATA_SLOT_COUNT, !libraryReady)) {
+        Serial.println("DataStore: 码库不可用");
+    } else {
+        if (!libraryReady) {
+            preferences.putBool(KEY_CODELIB_READY, true);
+        }
+        if (codeLibrary.IsCreated()) {
+            // 新建的码库：导入NVS中已有的槽位记录；从码库读回校验一致后才删除NVS中的记录
+            int imported = 0;
+            for (int index = 1; index <= NVS_RECORD_SLOT_COUNT; index++) {
+                makeRecordKey(recordKey, index);
+                RadioRecord record;
+                RadioRecord stored;
+                if (preferences.getBytes(recordKey, &record, sizeof(record)) == sizeof(record) &&
+                    record.version == RADIO_RECORD_VERSION && record.nameLength > 0 &&
+                    codeLibrary.Write(index, record) && codeLibrary.Read(index, stored) &&
+                    memcmp(&record, &stored, sizeof(record)) == 0) {
+                    preferences.remove(recordKey);
+                    imported++;
+                }
+            }
+            Serial.print("DataStore: 已从NVS导入码库，条数: ");
+            Serial.println(imported);
+        }
+    }
+    for (int index = 1; index <= RADIO_DATA_SLOT_COUNT; index++) {
+        if (slotKeys[index - 1].used) {
+            setSlotOccupied(index, true);
+            count++;
+        }
+    }
+#else
+    memset(slotRecords, 0, sizeof(slotRecords));
+    memset(slotKeys, 0, sizeof(slotKeys));
+    for (int index = 1; index <= RADIO_DATA_SLOT_COUNT; index++) {
+        makeRecordKey(recordKey, index);
+        RadioRecord& record = slotRecords[index - 1];
+        if (preferences.getBytes(recordKey, &record, sizeof(record)) == sizeof(record) &&
+            record.version == RADIO_RECORD_VERSION && record.nameLength > 0) {
+            makeSlotKey(record, slotKeys[index - 1]);
+            setSlotOccupied(index, true);
+            count++;
+        } else {
+            memset(&record, 0, sizeof(record));
+        }
+    }
+#endif
+    preferences.end();
+
+    rebuildCodeIndex();
+    slotCacheLoaded = true;
+    Serial.print("DataStore: 槽位数据已加载，已占用: ");
+    Serial.println(count);
+}
+
+static_assert((RADIO_CODE_INDEX_SIZE & (RADIO_CODE_INDEX_SIZE - 1)) == 0,
+              "RADIO_CODE_INDEX_SIZE must be a power of two");
+static_assert(RADIO_CODE_INDEX_SIZE > RADIO_DATA_SLOT_COUNT && RADIO_DATA_SLOT_COUNT < 65536,
+              "code index must have a free bucket and store slot numbers in 16 bits");
+
+static uint32_t hashCode(uint8_t freqType, uint8_t protocol, uint8_t bitLength, uint32_t data)
+{
+    uint32_t h = data ^ ((uint32_t)freqType << 24) ^ ((uint32_t)protocol << 16) ^ ((uint32_t)bitLength << 8);
+    // murmur3 finalizer
+    h ^= h >> 16;
+    h *= 0x85EBCA6B;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
+// 删除或覆盖会留下探测链空洞，直接按槽位顺序重建（只访问内存中的编码摘要，远小于一次Flash写入的开销）
+void DataStore::rebuildCodeIndex()
+{
+    memset(codeIndex, 0, sizeof(codeIndex));
+    for (int word = 0; word < (RADIO_DATA_SLOT_COUNT + 31) / 32; word++) {
+        uint32_t bits = slotBitmap[word];
+        while (bits != 0) {
+            const int index = word * 32 + __builtin_ctz(bits) + 1;
+            bits &= bits - 1;
+            insertCodeIndex(index);
+        }
+    }
+}
+
+// 把一个已占用槽位加入反查表；编码已存在时保留编号较小的槽位
+void DataStore::insertCodeIndex(int index)
+{
+    const SlotKey& key = slotKeys[index - 1];
+    uint32_t bucket = hashCode(key.freqType, key.protocol, key.bitLength, key.data) & (RADIO_CODE_INDEX_SIZE - 1);
+    while (codeIndex[bucket] != 0) {
+        const SlotKey& other = slotKeys[codeIndex[bucket] - 1];
+        if (other.data == key.data && other.freqType == key.freqType &&
+            other.protocol == key.protocol && other.bitLength == key.bitLength) {
+            if (index < codeIndex[bucket]) {
+                codeIndex[bucket] = (uint16_t)index;
+            }
+            return;
+        }
+        bucket = (bucket + 1) & (RADIO_CODE_INDEX_SIZE - 1);
+    }
+    codeIndex[bucket] = (uint16_t)index;
+}
+
+int DataStore::findSlotByCodeLocked(uint8_t freqType, uint8_t protocol, uint8_t bitLength, uint32_t data)
+{
+    uint32_t bucket = hashCode(freqType, protocol, bitLength, data) & (RADIO_CODE_INDEX_SIZE - 1);
+    while (codeIndex[bucket] != 0) {
+        const SlotKey& key = slotKeys[codeIndex[bucket] - 1];
+        if (key.data == data && key.freqType == freqType &&
+            key.protocol == protocol && key.bitLength == bitLength) {
+            return codeIndex[bucket];
+        }
+        bucket = (bucket + 1) & (RADIO_CODE_INDEX_SIZE - 1);
+    }
+    return -1;
+}
+
+int DataStore::FindSlotByCode(const RCData& code)
+{
+    if (preferencesMutex == nullptr) {
+        return -1;
+    }
+    int index = -1;
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        ensureSlotCache();
+        index = findSlotByCodeLocked((uint8_t)code.freqType, (uint8_t)code.protocal, (uint8_t)code.bitLength, (uint32_t)code.data);
+        xSemaphoreGive(preferencesMutex);
+    } else {
+        Serial.println("DataStore::FindSlotByCode: 获取互斥锁超时");
+    }
+    return index;
+}
+
+void DataStore::setSlotOccupied(int index, bool occupied)
+{
+    const uint32_t bit = 1UL << ((index - 1) % 32);
+    if (occupied) {
+        slotBitmap[(index - 1) / 32] |= bit;
+    } else {
+        slotBitmap[(index - 1) / 32] &= ~bit;
+    }
+}
+
+// 将旧版每槽位六个键的数据转换为槽位记录，写入成功后才删除旧键释放NVS空间
+// 返回是否全部迁移成功
+bool DataStore::migrateLegacyData()
+{
+    static const char* legacyKeys[] = {
+        KEY_NAME, KEY_FREQTYPE, KEY_DATA, KEY_BITLENGTH, KEY_PULSELENGTH, KEY_PROTOCAL
+    };
+    char key[32];
+    int migrated = 0;
+    int failed = 0;
+
+    for (int index = 1; index <= NVS_RECORD_SLOT_COUNT; index++) {
+        makeLegacyKey(key, KEY_NAME, index);
+        if (!preferences.isKey(key)) {
+            continue;
+        }
+
+        // 上次迁移中断后槽位可能已被重新保存，新记录优先，只清理旧键
+        makeRecordKey(key, index);
+        const bool hasRecord = preferences.isKey(key);
+        makeLegacyKey(key, KEY_NAME, index);
+
+        RadioData radioData;
+        radioData.name = preferences.getString(key);
+        makeLegacyKey(key, KEY_FREQTYPE, index);
+        radioData.rcData.freqType = (FreqType)preferences.getUInt(key);
+        makeLegacyKey(key, KEY_BITLENGTH, index);
+        radioData.rcData.bitLength = preferences.getUInt(key);
+        makeLegacyKey(key, KEY_PROTOCAL, index);
+        radioData.rcData.protocal = preferences.getUInt(key);
+        makeLegacyKey(key, KEY_DATA, index);
+        radioData.rcData.data = preferences.getUInt(key);
+        makeLegacyKey(key, KEY_PULSELENGTH, index);
+        radioData.rcData.pulseLength = preferences.getUInt(key);
+
+        if (radioData.name.length() > 0 && !hasRecord) {
+            RadioRecord record;
+            packRecord(radioData, record);
+            makeRecordKey(key, index);
+            if (preferences.putBytes(key, &record, sizeof(record)) != sizeof(record)) {
+                // NVS空间不足：保留旧键，不能丢失数据
+                failed++;
+                continue;
+            }
+            migrated++;
+        }
+
+        for (size_t i = 0; i < sizeof(legacyKeys) / sizeof(legacyKeys[0]); i++) {
+            makeLegacyKey(key, legacyKeys[i], index);
+            preferences.remove(key);
+        }
+    }
+
+    Serial.print("DataStore: 旧格式数据迁移完成，条数: ");
+    Serial.print(migrated);
+    Serial.print("，失败: ");
+    Serial.println(failed);
+    return failed == 0;
+}
+
+bool DataStore::SaveData(int index, const RadioData& radioData)
 {
     // 检查互斥锁是否有效
     if (preferencesMutex == nullptr) {
         Serial.println("DataStore::SaveData: 互斥锁未初始化");
-        return;
+        return false;
+    }
+    if (index < 1 || index > RADIO_DATA_SLOT_COUNT) {
+        Serial.println("DataStore::SaveData: 槽位编号无效");
+        return false;
     }
     
+    bool saved = false;
     // 获取互斥锁，增加超时保护
     if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
-        char keySuffix[16];
-        sprintf(keySuffix, "_%d", index);
-        
-        char nameKey[32];
-        char freqTypeKey[32];
-        char dataKey[32];
-        char bitLengthKey[32];
-        char pulseLengthKey[32];
-        char protocolKey[32];
-        
-        strcpy(nameKey, KEY_NAME);
-        strcat(nameKey, keySuffix);
-        
-        strcpy(freqTypeKey, KEY_FREQTYPE);
-        strcat(freqTypeKey, keySuffix);
-        
-        strcpy(dataKey, KEY_DATA);
-        strcat(dataKey, keySuffix);
-        
-        strcpy(bitLengthKey, KEY_BITLENGTH);
-        strcat(bitLengthKey, keySuffix);
-        
-        strcpy(pulseLengthKey, KEY_PULSELENGTH);
-        strcat(pulseLengthKey, keySuffix);
-        
-        strcpy(protocolKey, KEY_PROTOCAL);
-        strcat(protocolKey, keySuffix);
+        ensureSlotCache();
+        const bool wasOccupied = isSlotOccupiedLocked(index);
 
+#if DATASTORE_USE_LITTLEFS
+        // 名称为空表示删除，码库追加一条空记录；槽位摘要由码库同步更新
+        RadioRecord record;
+        if (radioData.name.length() > 0) {
+            packRecord(radioData, record);
+        } else {
+            memset(&record, 0, sizeof(record));
+        }
+        saved = codeLibrary.Write(index, record);
+        if (saved) {
+            setSlotOccupied(index, record.nameLength > 0);
+        }
+#else
+        char recordKey[16];
+        makeRecordKey(recordKey, index);
+        RadioRecord record;
+
+        // 先写Flash，成功后再同步内存镜像
         preferences.begin(KEY_NAMESPACE);
-        preferences.putString(nameKey, radioData.name);
-        preferences.putUInt(freqTypeKey, (uint32_t)radioData.rcData.freqType);
-        preferences.putUInt(bitLengthKey, radioData.rcData.bitLength);
-        preferences.putUInt(protocolKey, radioData.rcData.protocal);
-        preferences.putUInt(dataKey, radioData.rcData.data);
-        preferences.putUInt(pulseLengthKey, radioData.rcData.pulseLength);
-        
+        if (radioData.name.length() > 0) {
+            packRecord(radioData, record);
+            saved = preferences.putBytes(recordKey, &record, sizeof(record)) == sizeof(record);
+        } else {
+            // 名称为空表示删除，直接移除记录释放NVS空间
+            memset(&record, 0, sizeof(record));
+            saved = !wasOccupied || preferences.remove(recordKey);
+        }
         preferences.end();
+        if (saved) {
+            slotRecords[index - 1] = record;
+            setSlotOccupied(index, record.nameLength > 0);
+            makeSlotKey(record, slotKeys[index - 1]);
+        }
+#endif
+        if (!saved) {
+            Serial.println("DataStore::SaveData: 写入Flash失败");
+        } else if (!wasOccupied) {
+            // 新占用的槽位只需插入反查表（批量导入时避免每条都全量重建）
+            if (isSlotOccupiedLocked(index)) {
+                insertCodeIndex(index);
+            }
+        } else {
+            rebuildCodeIndex();
+        }
         
         // 释放互斥锁
         xSemaphoreGive(preferencesMutex);
     } else {
         Serial.println("DataStore::SaveData: 获取互斥锁超时");
     }
+    return saved;
+}
+
+void DataStore::FormatSlotListItem(int index, char* buffer, size_t size)
+{
+    RadioData data;
+    if (ReadData(index + 1, data)) {
+        snprintf(buffer, size, "%d. %s", index + 1, data.name.c_str());
+    } else {
+        snprintf(buffer, size, "%d. ----------", index + 1);
+    }
 }
 
 RadioData DataStore::ReadData(int index)
 {
     RadioData radioData;
+    ReadData(index, radioData);
+    return radioData;
+}
+
+bool DataStore::ReadData(int index, RadioData& radioData)
+{
+    radioData.name.clear();
+    memset(&radioData.rcData, 0, sizeof(radioData.rcData));
     
     // 检查互斥锁是否有效
     if (preferencesMutex == nullptr) {
         Serial.println("DataStore::ReadData: 互斥锁未初始化");
-        return radioData;
+        return false;
+    }
+    if (index < 1 || index > RADIO_DATA_SLOT_COUNT) {
+        return false;
     }
     
+    bool found = false;
     // 获取互斥锁，增加超时保护
     if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
-        char keySuffix[16];
-        sprintf(keySuffix, "_%d", index);
-        
-        char nameKey[32];
-        char freqTypeKey[32];
-        char dataKey[32];
-        char bitLengthKey[32];
-        char pulseLengthKey[32];
-        char protocolKey[32];
-        
-        strcpy(nameKey, KEY_NAME);
-        strcat(nameKey, keySuffix);
-        
-        strcpy(freqTypeKey, KEY_FREQTYPE);
-        strcat(freqTypeKey, keySuffix);
-        
-        strcpy(dataKey, KEY_DATA);
-        strcat(dataKey, keySuffix);
-        
-        strcpy(bitLengthKey, KEY_BITLENGTH);
-        strcat(bitLengthKey, keySuffix);
-        
-        strcpy(pulseLengthKey, KEY_PULSELENGTH);
-        strcat(pulseLengthKey, keySuffix);
-        
-        strcpy(protocolKey, KEY_PROTOCAL);
-        strcat(protocolKey, keySuffix);
-
-        preferences.begin(KEY_NAMESPACE);
-        radioData.name = preferences.getString(nameKey);
-        radioData.rcData.freqType = (FreqType)preferences.getUInt(freqTypeKey);
-        radioData.rcData.bitLength = preferences.getUInt(bitLengthKey);
-        radioData.rcData.protocal = preferences.getUInt(protocolKey);
-        radioData.rcData.data = preferences.getUInt(dataKey);
-        radioData.rcData.pulseLength = preferences.getUInt(pulseLengthKey);
-        preferences.end();
+        ensureSlotCache();
+        if (isSlotOccupiedLocked(index)) {
+#if DATASTORE_USE_LITTLEFS
+            RadioRecord record;
+            if (codeLibrary.Read(index, record)) {
+                unpackRecord(record, radioData);
+                found = true;
+            }
+#else
+            unpackRecord(slotRecords[index - 1], radioData);
+            found = true;
+#endif
+        }
         
         // 释放互斥锁
         xSemaphoreGive(preferencesMutex);
@@ -193,7 +503,184 @@ RadioData DataStore::ReadData(int index)
         Serial.println("DataStore::ReadData: 获取互斥锁超时");
     }
     
-    return radioData;
+    return found;
+}
+
+bool DataStore::isSlotOccupiedLocked(int index)
+{
+    return (slotBitmap[(index - 1) / 32] >> ((index - 1) % 32)) & 1;
+}
+
+bool DataStore::IsSlotOccupied(int index)
+{
+    if (preferencesMutex == nullptr || index < 1 || index > RADIO_DATA_SLOT_COUNT) {
+        return false;
+    }
+    bool occupied = false;
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        ensureSlotCache();
+        occupied = isSlotOccupiedLocked(index);
+        xSemaphoreGive(preferencesMutex);
+    } else {
+        Serial.println("DataStore::IsSlotOccupied: 获取互斥锁超时");
+    }
+    return occupied;
+}
+
+int DataStore::FindFreeSlot()
+{
+    if (preferencesMutex == nullptr) {
+        return -1;
+    }
+    int freeIndex = -1;
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        ensureSlotCache();
+        for (int word = 0; word < (RADIO_DATA_SLOT_COUNT + 31) / 32; word++) {
+            const uint32_t freeBits = ~slotBitmap[word];
+            if (freeBits == 0) {
+                continue;
+            }
+            const int index = word * 32 + __builtin_ctz(freeBits) + 1;
+            if (index <= RADIO_DATA_SLOT_COUNT) {
+                freeIndex = index;
+            }
+            break;
+        }
+        xSemaphoreGive(preferencesMutex);
+    } else {
+        Serial.println("DataStore::FindFreeSlot: 获取互斥锁超时");
+    }
+    return freeIndex;
+}
+
+int DataStore::GetOccupiedSlots(int* indices, int maxCount, int firstIndex)
+{
+    if (preferencesMutex == nullptr || firstIndex > RADIO_DATA_SLOT_COUNT) {
+        return 0;
+    }
+    if (firstIndex < 1) {
+        firstIndex = 1;
+    }
+    int count = 0;
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        ensureSlotCache();
+        // 起始字内先屏蔽掉 firstIndex 之前的位
+        const int firstWord = (firstIndex - 1) / 32;
+        for (int word = firstWord; word < (RADIO_DATA_SLOT_COUNT + 31) / 32 && count < maxCount; word++) {
+            uint32_t bits = slotBitmap[word];
+            if (word == firstWord) {
+                bits &= ~0UL << ((firstIndex - 1) % 32);
+            }
+            while (bits != 0 && count < maxCount) {
+                indices[count++] = word * 32 + __builtin_ctz(bits) + 1;
+                bits &= bits - 1;
+            }
+        }
+        xSemaphoreGive(preferencesMutex);
+    } else {
+        Serial.println("DataStore::GetOccupiedSlots: 获取互斥锁超时");
+    }
+    return count;
+}
+
+int DataStore::GetOccupiedCount()
+{
+    if (preferencesMutex == nullptr) {
+        return 0;
+    }
+    int count = 0;
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        ensureSlotCache();
+        for (int word = 0; word < (RADIO_DATA_SLOT_COUNT + 31) / 32; word++) {
+            count += __builtin_popcount(slotBitmap[word]);
+        }
+        xSemaphoreGive(preferencesMutex);
+    }
+    return count;
+}
+
+uint32_t DataStore::SaveDataAsync(int index, const RadioData& radioData)
+{
+    if (index < 1 || index > RADIO_DATA_SLOT_COUNT) {
+        Serial.println("DataStore::SaveDataAsync: 槽位编号无效");
+        return 0;
+    }
+    return submitJob(index, radioData);
+}
+
+uint32_t DataStore::ClearAllDataAsync()
+{
+    RadioData emptyData;
+    memset(&emptyData.rcData, 0, sizeof(emptyData.rcData));
+    return submitJob(0, emptyData);
+}
+
+uint32_t DataStore::submitJob(int index, const RadioData& radioData)
+{
+    if (jobQueue == nullptr) {
+        return 0;
+    }
+    StoreJob job;
+    job.id = lastJobId + 1;
+    if (job.id == 0) {
+        job.id = 1;
+    }
+    job.index = index;
+    job.radioData = radioData;
+    if (xQueueSend(jobQueue, &job, 0) != pdTRUE) {
+        Serial.println("DataStore: 异步写入队列已满");
+        return 0;
+    }
+    lastJobId = job.id;
+    return job.id;
+}
+
+StoreJobState DataStore::GetJobState(uint32_t jobId)
+{
+    if (jobId == 0) {
+        return STORE_JOB_FAILED;
+    }
+    // 编号回绕时按有符号差值比较
+    if ((int32_t)(jobId - finishedJobId) > 0) {
+        return STORE_JOB_PENDING;
+    }
+    return ((failedJobBits >> (jobId % 32)) & 1) ? STORE_JOB_FAILED : STORE_JOB_DONE;
+}
+
+void DataStore::Update()
+{
+    // 执行页面提交的写入任务，先记录结果再更新完成编号
+    StoreJob job;
+    while (jobQueue != nullptr && xQueueReceive(jobQueue, &job, 0) == pdTRUE) {
+        const bool ok = (job.index == 0) ? ClearAllData() : SaveData(job.index, job.radioData);
+        const uint32_t bit = 1UL << (job.id % 32);
+        failedJobBits = ok ? (failedJobBits & ~bit) : (failedJobBits | bit);
+        finishedJobId = job.id;
+    }
+
+#if DATASTORE_USE_LITTLEFS
+    // 只在已加载且锁空闲时做一步维护，不阻塞主循环
+    if (preferencesMutex == nullptr || !slotCacheLoaded) {
+        return;
+    }
+    if (xSemaphoreTake(preferencesMutex, 0) == pdTRUE) {
+        codeLibrary.Update();
+        xSemaphoreGive(preferencesMutex);
+    }
+#endif
+}
+
+void DataStore::ReloadSlotCache()
+{
+    if (preferencesMutex == nullptr) {
+        return;
+    }
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        slotCacheLoaded = false;
+        xSemaphoreGive(preferencesMutex);
+    } else {
+        Serial.println("DataStore::ReloadSlotCache: 获取互斥锁超时");
+    }
 }
 
 void DataStore::SaveQuickKey(QuickKey keyData)
@@ -306,61 +793,76 @@ QuickKey DataStore::LoadQuickKey()
     return quickKey;
 }
 
-void DataStore::SaveSystemConfig(SystemConfig systemConfig)
+int DataStore::SaveSystemConfig(const SystemConfig& systemConfig, uint32_t fieldMask)
 {
     // 检查互斥锁是否有效
     if (preferencesMutex == nullptr) {
         Serial.println("DataStore::SaveSystemConfig: 互斥锁未初始化");
-        return;
+        return 0;
     }
+    int written = 0;
     // 获取互斥锁，增加超时保护
     if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
         preferences.begin(KEY_NAMESPACE);
 
-        preferences.putBool(KEY_BUZZER_ENABLE, systemConfig.buzzerEnable);
-        preferences.putInt(KEY_REPEAT_TRANSMIT, systemConfig.repeatTransmit);
-        preferences.putInt(KEY_BRIGHTNESS, systemConfig.brightness);
-        preferences.putLong(KEY_AUTO_SLEEP_TIME, systemConfig.autoSleepTime);
-        preferences.putLong(KEY_AUTO_SCREEN_OFF_TIME, systemConfig.autoScreenOffTime);
-        preferences.putBool(KEY_AP_ENABLED, systemConfig.APEnabled);
-        preferences.putBool(KEY_WIFI_ENABLED, systemConfig.WifiEnabled);
-        preferences.putString(KEY_AP_NAME, systemConfig.APName);
-        preferences.putString(KEY_AP_PASSWORD, systemConfig.APPassword);
-        preferences.putString(KEY_WIFI_NAME, systemConfig.WifiName);
-        preferences.putString(KEY_WIFI_PASSWORD, systemConfig.WifiPassword);
+        // 只写入掩码中的键，未修改的配置不产生Flash写入
+        if (fieldMask & CONFIG_FIELD_BUZZER_ENABLE) {
+            preferences.putBool(KEY_BUZZER_ENABLE, systemConfig.buzzerEnable);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_REPEAT_TRANSMIT) {
+            preferences.putInt(KEY_REPEAT_TRANSMIT, systemConfig.repeatTransmit);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_BRIGHTNESS) {
+            preferences.putInt(KEY_BRIGHTNESS, systemConfig.brightness);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_AUTO_SLEEP_TIME) {
+            preferences.putLong(KEY_AUTO_SLEEP_TIME, systemConfig.autoSleepTime);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_AUTO_SCREEN_OFF) {
+            preferences.putLong(KEY_AUTO_SCREEN_OFF_TIME, systemConfig.autoScreenOffTime);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_AP_ENABLED) {
+            preferences.putBool(KEY_AP_ENABLED, systemConfig.APEnabled);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_WIFI_ENABLED) {
+            preferences.putBool(KEY_WIFI_ENABLED, systemConfig.WifiEnabled);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_AP_NAME) {
+            preferences.putString(KEY_AP_NAME, systemConfig.APName);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_AP_PASSWORD) {
+            preferences.putString(KEY_AP_PASSWORD, systemConfig.APPassword);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_WIFI_NAME) {
+            preferences.putString(KEY_WIFI_NAME, systemConfig.WifiName);
+            written++;
+        }
+        if (fieldMask & CONFIG_FIELD_WIFI_PASSWORD) {
+            preferences.putString(KEY_WIFI_PASSWORD, systemConfig.WifiPassword);
+            written++;
+        }
         preferences.end();
 
         // 释放互斥锁
         xSemaphoreGive(preferencesMutex);
 
-        // 打印出值
-        Serial.print("SystemConfig: ");
-        Serial.print(systemConfig.buzzerEnable);
-        Serial.print(", ");
-        Serial.print(systemConfig.repeatTransmit);
-        Serial.print(", ");
-        Serial.print(systemConfig.brightness);
-        Serial.print(", ");
-        Serial.print(systemConfig.autoSleepTime);
-        Serial.print(", ");
-        Serial.print(systemConfig.autoScreenOffTime);
-        Serial.print(", ");
-        Serial.print(systemConfig.APEnabled);
-        Serial.print(", ");
-        Serial.print(systemConfig.WifiEnabled);
-        Serial.print(", ");
-        Serial.print(systemConfig.APName);
-        Serial.print(", ");
-        Serial.print(systemConfig.APPassword);
-        Serial.print(", ");
-        Serial.print(systemConfig.WifiName);
-        Serial.print(", ");
-        Serial.print(systemConfig.WifiPassword);
-        Serial.println();
+        Serial.print("SystemConfig: 已写入键数 ");
+        Serial.print(written);
+        Serial.print(", 掩码 0x");
+        Serial.println(fieldMask, HEX);
     } else {
         Serial.println("DataStore::SaveSystemConfig: 获取互斥锁超时");
     }
-    Serial.println("DataStore: SaveSystemConfig() 执行完成");
+    return written;
 }
 
 SystemConfig DataStore::LoadSystemConfig()
@@ -424,14 +926,15 @@ SystemConfig DataStore::LoadSystemConfig()
     return systemConfig;
 }
 
-void DataStore::ClearAllData()
+bool DataStore::ClearAllData()
 {
     // 检查互斥锁是否有效
     if (preferencesMutex == nullptr) {
         Serial.println("DataStore::ClearAllData: 互斥锁未初始化");
-        return;
+        return false;
     }
     
+    bool cleared = false;
     // 获取互斥锁，增加超时保护
     if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
         Serial.println("DataStore: ClearAllData() 开始清空所有数据");
@@ -439,7 +942,20 @@ void DataStore::ClearAllData()
         preferences.begin(KEY_NAMESPACE);
         
         // 清空所有数据
-        preferences.clear();
+        cleared = preferences.clear();
+        
+#if DATASTORE_USE_LITTLEFS
+        cleared = codeLibrary.Clear() && cleared;
+#endif
+
+        // 清空内存镜像；版本标记随之清除，下次访问时重新写入
+#if !DATASTORE_USE_LITTLEFS
+        memset(slotRecords, 0, sizeof(slotRecords));
+#endif
+        memset(slotKeys, 0, sizeof(slotKeys));
+        memset(slotBitmap, 0, sizeof(slotBitmap));
+        memset(codeIndex, 0, sizeof(codeIndex));
+        slotCacheLoaded = false;
         
         preferences.end();
         
@@ -450,6 +966,58 @@ void DataStore::ClearAllData()
     } else {
         Serial.println("DataStore::ClearAllData: 获取互斥锁超时");
     }
+    return cleared;
+}
+
+bool DataStore::ClearRadioData()
+{
+    // 检查互斥锁是否有效
+    if (preferencesMutex == nullptr) {
+        Serial.println("DataStore::ClearRadioData: 互斥锁未初始化");
+        return false;
+    }
+
+    bool cleared = true;
+    // 获取互斥锁，增加超时保护
+    if (xSemaphoreTake(preferencesMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+        ensureSlotCache();
+
+#if DATASTORE_USE_LITTLEFS
+        // 码库换用新日志，槽位摘要由码库一并清空
+        cleared = codeLibrary.Clear();
+        memset(slotBitmap, 0, sizeof(slotBitmap));
+#else
+        // 逐个删除槽位记录，删除失败的槽位保留在内存镜像中
+        char recordKey[16];
+        preferences.begin(KEY_NAMESPACE);
+        for (int index = 1; index <= RADIO_DATA_SLOT_COUNT; index++) {
+            if (!isSlotOccupiedLocked(index)) {
+                continue;
+            }
+            makeRecordKey(recordKey, index);
+            if (!preferences.remove(recordKey)) {
+                cleared = false;
+                continue;
+            }
+            memset(&slotRecords[index - 1], 0, sizeof(RadioRecord));
+            memset(&slotKeys[index - 1], 0, sizeof(SlotKey));
+            setSlotOccupied(index, false);
+        }
+        preferences.end();
+#endif
+        rebuildCodeIndex();
+
+        // 释放互斥锁
+        xSemaphoreGive(preferencesMutex);
+
+        if (!cleared) {
+            Serial.println("DataStore::ClearRadioData: 部分数据删除失败");
+        }
+    } else {
+        Serial.println("DataStore::ClearRadioData: 获取互斥锁超时");
+        cleared = false;
+    }
+    return cleared;
 }
 
 bool DataStore::SaveWiFiConfig(const String& ssid, const String& password)
@@ -11,6 +11,7 @@
 #include <WString.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/queue.h>
 
 enum class MQTTMode {
     AUTO,
@@ -28,12 +29,115 @@ struct QuickKey{
     int key8;
     int key9;
 };
+// 遥控数据存储后端：0 = NVS（每个槽位一条blob记录），1 = LittleFS追加式码库（CodeLibrary）
+#ifndef DATASTORE_USE_LITTLEFS
+#define DATASTORE_USE_LITTLEFS 0
+#endif
+
+// 遥控数据槽位数量（槽位编号 1..RADIO_DATA_SLOT_COUNT）
+#if DATASTORE_USE_LITTLEFS
+#define RADIO_DATA_SLOT_COUNT 2000
+#else
+#define RADIO_DATA_SLOT_COUNT 100
+#endif
+// 记录中名称的最大字节数（UTF-8，超出部分按字符边界截断）
+#define RADIO_NAME_MAX_BYTES 52
+// 遥控数据名称：内联定长UTF-8缓冲区，复制和传递都不分配堆内存，超长时在字符边界截断
+class RadioName
+{
+public:
+    RadioName() { clear(); }
+    RadioName(const char* text) { assign(text); }
+    RadioName(const String& text) { assign(text.c_str(), text.length()); }
+
+    RadioName& operator=(const char* text) { assign(text); return *this; }
+    RadioName& operator=(const String& text) { assign(text.c_str(), text.length()); return *this; }
+
+    void assign(const char* text) { assign(text, text != nullptr ? strlen(text) : 0); }
+    void assign(const char* text, size_t length)
+    {
+        if (text == nullptr) {
+            length = 0;
+        }
+        if (length > RADIO_NAME_MAX_BYTES) {
+            length = RADIO_NAME_MAX_BYTES;
+            // 退回到完整UTF-8字符的边界
+            while (length > 0 && ((uint8_t)text[length] & 0xC0) == 0x80) {
+                length--;
+            }
+        }
+        if (length > 0) {
+            memcpy(buffer, text, length);
+        }
+        buffer[length] = '\0';
+        size = (uint8_t)length;
+    }
+    void clear() { buffer[0] = '\0'; size = 0; }
+
+    const char* c_str() const { return buffer; }
+    size_t length() const { return size; }
+    bool isEmpty() const { return size == 0; }
+    bool operator==(const char* text) const { return text != nullptr && strcmp(buffer, text) == 0; }
+    bool operator!=(const char* text) const { return !(*this == text); }
+
+private:
+    char buffer[RADIO_NAME_MAX_BYTES + 1];
+    uint8_t size;
+};
+
 struct RadioData
 {
-    String name;
+    RadioName name;
     RCData rcData;
 };
 
+// 槽位记录格式版本
+#define RADIO_RECORD_VERSION 1
+// 编码反查表容量（2的幂，至少为槽位数的1.25倍以保证探测长度短）
+#if DATASTORE_USE_LITTLEFS
+#define RADIO_CODE_INDEX_SIZE 4096
+#else
+#define RADIO_CODE_INDEX_SIZE 128
+#endif
+
+// 每个槽位在NVS中保存为一条定长二进制记录（一个blob键），替代原来的六个键
+struct __attribute__((packed)) RadioRecord
+{
+    uint8_t version;
+    uint8_t freqType;
+    uint8_t protocol;
+    uint8_t bitLength;
+    uint16_t pulseLength;
+    uint8_t nameLength;
+    uint8_t reserved;
+    uint32_t data;
+    char name[RADIO_NAME_MAX_BYTES];
+};
+
+// 槽位的编码摘要，常驻内存用于反查，不含名称
+struct __attribute__((packed)) SlotKey
+{
+    uint32_t data;
+    uint8_t freqType;
+    uint8_t protocol;
+    uint8_t bitLength;
+    uint8_t used;
+};
+
+// 系统配置字段掩码，SaveSystemConfig只写入掩码中的键
+#define CONFIG_FIELD_BUZZER_ENABLE      (1UL << 0)
+#define CONFIG_FIELD_REPEAT_TRANSMIT    (1UL << 1)
+#define CONFIG_FIELD_BRIGHTNESS         (1UL << 2)
+#define CONFIG_FIELD_AUTO_SLEEP_TIME    (1UL << 3)
+#define CONFIG_FIELD_AUTO_SCREEN_OFF    (1UL << 4)
+#define CONFIG_FIELD_AP_ENABLED         (1UL << 5)
+#define CONFIG_FIELD_WIFI_ENABLED       (1UL << 6)
+#define CONFIG_FIELD_AP_NAME            (1UL << 7)
+#define CONFIG_FIELD_AP_PASSWORD        (1UL << 8)
+#define CONFIG_FIELD_WIFI_NAME          (1UL << 9)
+#define CONFIG_FIELD_WIFI_PASSWORD      (1UL << 10)
+#define CONFIG_FIELD_ALL                ((1UL << 11) - 1)
+
 struct SystemConfig{
     bool buzzerEnable;
     int repeatTransmit;
@@ -54,18 +158,51 @@ struct SystemConfig{
     String MQTTPassword;        // MQTT密码
 };
 
+// 异步写入任务的状态（渲染任务中的页面不直接写Flash，提交后查询结果）
+enum StoreJobState {
+    STORE_JOB_PENDING,
+    STORE_JOB_DONE,
+    STORE_JOB_FAILED
+};
+
+// 异步写入队列长度
+#define DATASTORE_JOB_QUEUE_SIZE 4
+
 class DataStore
 {
 public:
     DataStore();
     ~DataStore();
-    void SaveData(int index, RadioData radioData);
+    bool SaveData(int index, const RadioData& radioData); // 写入Flash失败返回false，内存镜像保持不变
     RadioData ReadData(int index);
+    bool ReadData(int index, RadioData& radioData);      // 读入调用者的结构体，槽位为空返回false
+    void FormatSlotListItem(int index, char* buffer, size_t size); // 码库列表菜单行："序号. 名称"，空槽位显示横线（index从0开始）
     void SaveQuickKey(QuickKey keyData);
     QuickKey LoadQuickKey();
-    void SaveSystemConfig(SystemConfig systemConfig);
+    int SaveSystemConfig(const SystemConfig& systemConfig, uint32_t fieldMask = CONFIG_FIELD_ALL); // 返回写入的键数
     SystemConfig LoadSystemConfig();
-    void ClearAllData(); // 清空所有存储数据
+    bool ClearAllData(); // 清空所有存储数据
+    bool ClearRadioData(); // 只删除全部遥控数据（系统配置保留），编码反查表只重建一次
+
+    // 槽位占用查询（基于内存镜像，不访问Flash）
+    bool IsSlotOccupied(int index);
+    int FindFreeSlot();                                  // 第一个空槽位，没有空位返回-1
+    int GetOccupiedSlots(int* indices, int maxCount, int firstIndex = 1); // 从firstIndex起按编号升序列出已占用槽位，返回数量
+    int GetOccupiedCount();
+
+    // 按编码（频段、协议、位长、数据）反查已保存的槽位，未保存返回-1
+    int FindSlotByCode(const RCData& code);
+
+    // 异步写入：只在渲染任务中提交，由主循环的 Update() 执行
+    // 返回任务编号，0表示队列已满；用 GetJobState() 查询结果
+    uint32_t SaveDataAsync(int index, const RadioData& radioData);
+    uint32_t ClearAllDataAsync();
+    StoreJobState GetJobState(uint32_t jobId);
+
+    // 存储后台维护（异步写入、LittleFS码库的分步压缩与索引快照），在主循环中调用
+    void Update();
+    // 丢弃槽位内存镜像，下次访问时重新从Flash加载（用于测量冷启动加载耗时）
+    void ReloadSlotCache();
     
     // WiFi配置相关方法
     bool SaveWiFiConfig(const String& ssid, const String& password);
@@ -83,6 +220,37 @@ public:
 private:
     // 添加互斥锁以确保线程安全
     SemaphoreHandle_t preferencesMutex;
+    // 槽位占用位图与编码摘要：首次访问时从Flash加载一次，写入时同步更新
+#if !DATASTORE_USE_LITTLEFS
+    // NVS后端槽位少，整条记录都镜像在内存中
+    RadioRecord slotRecords[RADIO_DATA_SLOT_COUNT];
+#endif
+    SlotKey slotKeys[RADIO_DATA_SLOT_COUNT];
+    uint32_t slotBitmap[(RADIO_DATA_SLOT_COUNT + 31) / 32];
+    bool slotCacheLoaded;
+
+    // 异步写入任务，index为0表示清空全部数据
+    struct StoreJob {
+        uint32_t id;
+        int index;
+        RadioData radioData;
+    };
+    QueueHandle_t jobQueue;
+    uint32_t lastJobId;                       // 最近提交的任务编号（只在渲染任务中修改）
+    volatile uint32_t finishedJobId;          // 最近完成的任务编号，任务按提交顺序执行
+    volatile uint32_t failedJobBits;          // 最近32个任务的结果，按编号取模，1表示失败
+    uint32_t submitJob(int index, const RadioData& radioData);
+
+    void ensureSlotCache();
+    bool migrateLegacyData();
+    void setSlotOccupied(int index, bool occupied);
+    bool isSlotOccupiedLocked(int index);
+
+    // 编码 -> 槽位 的开放寻址哈希表（线性探测，0表示空），相同编码保留编号最小的槽位
+    uint16_t codeIndex[RADIO_CODE_INDEX_SIZE];
+    void rebuildCodeIndex();
+    void insertCodeIndex(int index);
+    int findSlotByCodeLocked(uint8_t freqType, uint8_t protocol, uint8_t bitLength, uint32_t data);
 };
 
 #endif
\ No newline at end of file
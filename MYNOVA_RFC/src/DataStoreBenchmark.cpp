@@ -0,0 +1,174 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "DataStoreBenchmark.h"
+
+DataStoreBenchmark::DataStoreBenchmark(DataStore* store)
+{
+    pDataStore = store;
+}
+
+DataStoreBenchmarkConfig DataStoreBenchmark::DefaultConfig()
+{
+    DataStoreBenchmarkConfig config;
+    config.iterations = 1000;
+    config.listPasses = 10;
+    config.configLoads = 20;
+    config.saves = 0;
+    config.coldLoad = true;
+    return config;
+}
+
+void DataStoreBenchmark::resetTimer(OpTimer& timer)
+{
+    timer.count = 0;
+    timer.totalMicros = 0;
+    timer.maxMicros = 0;
+}
+
+void DataStoreBenchmark::addSample(OpTimer& timer, uint32_t elapsed)
+{
+    timer.count++;
+    timer.totalMicros += elapsed;
+    if (elapsed > timer.maxMicros) {
+        timer.maxMicros = elapsed;
+    }
+}
+
+void DataStoreBenchmark::report(JsonObject item, const OpTimer& timer)
+{
+    item["ops"] = timer.count;
+    item["totalMicros"] = (uint32_t)timer.totalMicros;
+    item["maxMicros"] = timer.maxMicros;
+    if (timer.count > 0 && timer.totalMicros > 0) {
+        item["avgMicros"] = (uint32_t)(timer.totalMicros / timer.count);
+        item["opsPerSec"] = (float)timer.count * 1000000.0f / (float)timer.totalMicros;
+    }
+}
+
+void DataStoreBenchmark::Run(const DataStoreBenchmarkConfig& config, JsonDocument& result)
+{
+    const unsigned int iterations = constrain(config.iterations, 1u, (unsigned int)DATASTORE_BENCHMARK_MAX_ITERATIONS);
+    const unsigned int listPasses = constrain(config.listPasses, 1u, 100u);
+    const unsigned int configLoads = constrain(config.configLoads, 1u, 200u);
+    const unsigned int saves = (config.saves > DATASTORE_BENCHMARK_MAX_SAVES) ? DATASTORE_BENCHMARK_MAX_SAVES : config.saves;
+
+    result["backend"] = DATASTORE_USE_LITTLEFS ? "littlefs" : "nvs";
+    result["slotCount"] = RADIO_DATA_SLOT_COUNT;
+    result["freeHeapBefore"] = ESP.getFreeHeap();
+
+    OpTimer timer;
+    uint32_t start;
+
+    // 冷加载：丢弃内存镜像后的第一次访问会从Flash重新加载全部槽位
+    if (config.coldLoad) {
+        resetTimer(timer);
+        pDataStore->ReloadSlotCache();
+        start = micros();
+        pDataStore->GetOccupiedCount();
+        addSample(timer, micros() - start);
+        report(result["coldLoad"].to<JsonObject>(), timer);
+        delay(1);
+    }
+
+    // 收集已占用槽位，读测试在这些槽位间循环
+    const int occupied = pDataStore->GetOccupiedCount();
+    result["occupied"] = occupied;
+    int slots[32];
+    int slotCount = pDataStore->GetOccupiedSlots(slots, 32);
+    if (slotCount == 0) {
+        slots[0] = 1;
+        slotCount = 1;
+    }
+
+    RadioData radioData;
+    resetTimer(timer);
+    for (unsigned int n = 0; n < iterations; n++) {
+        start = micros();
+        pDataStore->ReadData(slots[n % slotCount], radioData);
+        addSample(timer, micros() - start);
+    }
+    report(result["readData"].to<JsonObject>(), timer);
+    delay(1);
+
+    // 按编码反查：使用已保存槽位的编码，全部命中
+    RCData codes[32];
+    for (int i = 0; i < slotCount; i++) {
+        pDataStore->ReadData(slots[i], radioData);
+        codes[i] = radioData.rcData;
+    }
+    resetTimer(timer);
+    for (unsigned int n = 0; n < iterations; n++) {
+        start = micros();
+        pDataStore->FindSlotByCode(codes[n % slotCount]);
+        addSample(timer, micros() - start);
+    }
+    report(result["findSlotByCode"].to<JsonObject>(), timer);
+    delay(1);
+
+    // 完整列表：与 /api/radiodata/list 相同的遍历方式，但不构建JSON
+    resetTimer(timer);
+    for (unsigned int pass = 0; pass < listPasses; pass++) {
+        start = micros();
+        int batch[32];
+        int batchCount;
+        int nextIndex = 1;
+        while ((batchCount = pDataStore->GetOccupiedSlots(batch, 32, nextIndex)) > 0) {
+            for (int i = 0; i < batchCount; i++) {
+                pDataStore->ReadData(batch[i], radioData);
+            }
+            nextIndex = batch[batchCount - 1] + 1;
+        }
+        addSample(timer, micros() - start);
+        delay(1);
+    }
+    report(result["listAll"].to<JsonObject>(), timer);
+
+    resetTimer(timer);
+    for (unsigned int n = 0; n < configLoads; n++) {
+        start = micros();
+        pDataStore->LoadSystemConfig();
+        addSample(timer, micros() - start);
+    }
+    report(result["loadSystemConfig"].to<JsonObject>(), timer);
+    delay(1);
+
+    // 写入：在一个空槽位上反复写入再删除，每对操作计为两次SaveData
+    if (saves > 0) {
+        const int freeIndex = pDataStore->FindFreeSlot();
+        if (freeIndex == -1) {
+            result["saveData"]["skipped"] = "no free slot";
+        } else {
+            RadioData emptyData;
+            memset(&emptyData.rcData, 0, sizeof(emptyData.rcData));
+            RadioData testData;
+            testData.name = "benchmark";
+            testData.rcData.bitLength = 24;
+            testData.rcData.protocal = 1;
+            testData.rcData.pulseLength = 350;
+            testData.rcData.freqType = FREQ_433;
+
+            resetTimer(timer);
+            for (unsigned int n = 0; n < saves; n++) {
+                // 使用少见的编码值，避免与已保存的数据重复
+                testData.rcData.data = 0xB5000000UL | n;
+                start = micros();
+                pDataStore->SaveData(freeIndex, testData);
+                addSample(timer, micros() - start);
+                start = micros();
+                pDataStore->SaveData(freeIndex, emptyData);
+                addSample(timer, micros() - start);
+                delay(1);
+            }
+            JsonObject item = result["saveData"].to<JsonObject>();
+            item["slot"] = freeIndex;
+            report(item, timer);
+        }
+    }
+
+    result["freeHeapAfter"] = ESP.getFreeHeap();
+    result["minFreeHeap"] = ESP.getMinFreeHeap();
+}
@@ -0,0 +1,50 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __DATASTOREBENCHMARK_H__
+#define __DATASTOREBENCHMARK_H__
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "DataStore.h"
+
+// 读操作的最大次数（在Web请求线程中同步执行，限制总耗时）
+#define DATASTORE_BENCHMARK_MAX_ITERATIONS 5000
+// 写操作的最大次数（每次都会写Flash，限制磨损）
+#define DATASTORE_BENCHMARK_MAX_SAVES 50
+
+struct DataStoreBenchmarkConfig{
+    unsigned int iterations;//ReadData/FindSlotByCode的调用次数
+    unsigned int listPasses;//完整遍历码库（列表）的次数
+    unsigned int configLoads;//LoadSystemConfig的调用次数
+    unsigned int saves;//SaveData的写入/删除对数，0表示不测试写入
+    bool coldLoad;//是否测量重新加载槽位镜像的耗时
+};
+
+/*
+ * 存储基准测试：测量 DataStore 各接口的吞吐量与单次耗时（设备上经 /api/datastore/benchmark，主机上见 host/），
+ * 用于比较不同存储布局。写入测试只使用一个空槽位，先写后删，不改动已有数据。
+ */
+class DataStoreBenchmark
+{
+public:
+    DataStoreBenchmark(DataStore* store);
+    static DataStoreBenchmarkConfig DefaultConfig();
+    void Run(const DataStoreBenchmarkConfig& config, JsonDocument& result);
+
+private:
+    struct OpTimer {
+        uint32_t count;
+        uint64_t totalMicros;
+        uint32_t maxMicros;
+    };
+    static void resetTimer(OpTimer& timer);
+    static void addSample(OpTimer& timer, uint32_t micros);
+    static void report(JsonObject item, const OpTimer& timer);
+
+    DataStore* pDataStore;
+};
+
+#endif
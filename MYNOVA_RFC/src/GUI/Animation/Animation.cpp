@@ -11,8 +11,11 @@ Animation::Animation(unsigned long duration) {
   this->state = ANIME_STATE_IDLE;
   this->startTime = 0;
   this->pauseTime = 0;
-  this->progress = 0.0f;
+  this->progress = 0;
+  this->progressScale = 0;
   this->onComplete = nullptr;
+  this->onCompleteContext = nullptr;
+  this->releaseHook = nullptr;
 }
 
 Animation::~Animation() {
@@ -26,16 +29,14 @@ void Animation::update() {
     
     if (elapsedTime >= this->duration) {
       // 动画完成
-      this->progress = 1.0f;
+      this->progress = ANIME_PROGRESS_ONE;
       this->state = ANIME_STATE_FINISHED;
       
       // 调用完成回调
-      if (this->onComplete) {
-        this->onComplete();
-      }
+      this->complete();
     } else {
-      // 更新进度
-      this->progress = (float)elapsedTime / (float)this->duration;
+      // 更新进度：elapsedTime < duration，乘积不超过 2^24
+      this->progress = (elapsedTime * this->progressScale) >> 8;
     }
   }
 }
@@ -43,7 +44,8 @@ void Animation::update() {
 void Animation::start() {
   this->startTime = millis();
   this->state = ANIME_STATE_RUNNING;
-  this->progress = 0.0f;
+  this->progress = 0;
+  this->progressScale = this->duration > 0 ? (1UL << 24) / this->duration : 0;
 }
 
 void Animation::pause() {
@@ -68,7 +70,7 @@ void Animation::stop() {
 
 void Animation::reset() {
   this->state = ANIME_STATE_IDLE;
-  this->progress = 0.0f;
+  this->progress = 0;
 }
 
 AnimationState Animation::getState() const {
@@ -76,9 +78,38 @@ AnimationState Animation::getState() const {
 }
 
 float Animation::getProgress() const {
+  return this->progress * (1.0f / ANIME_PROGRESS_ONE);
+}
+
+uint32_t Animation::getProgressFixed() const {
   return this->progress;
 }
 
-void Animation::setOnComplete(std::function<void()> callback) {
+void Animation::setOnComplete(AnimationCallback callback, void* context) {
   this->onComplete = callback;
+  this->onCompleteContext = context;
+}
+
+void Animation::complete() {
+  if (this->onComplete != nullptr) {
+    this->onComplete(this->onCompleteContext);
+  }
+}
+
+void Animation::destroy() {
+  if (this->releaseHook != nullptr) {
+    this->releaseHook(this);
+  } else {
+    delete this;
+  }
+}
+
+void runAnimationCallback(void* context) {
+  std::function<void()>* pending = static_cast<std::function<void()>*>(context);
+  if (*pending) {
+    // 先取出再调用，回调中可能再次设置新的回调
+    std::function<void()> callback = std::move(*pending);
+    *pending = nullptr;
+    callback();
+  }
 }
\ No newline at end of file
@@ -11,6 +11,14 @@
 #include <U8g2lib.h>
 #include <functional>
 
+// 定点进度的 1.0（Q16）
+#define ANIME_PROGRESS_ONE 65536
+
+// 动画完成回调：函数指针加上下文指针，不产生堆分配
+typedef void (*AnimationCallback)(void* context);
+
+template <class T, int N> class AnimationPool;
+
 // 动画类型枚举
 enum AnimationType {
     ANIME_NONE,
@@ -62,16 +70,34 @@ public:
   // 获取动画进度 (0.0 - 1.0)
   float getProgress() const;
   
+  // 获取定点进度 (0 - ANIME_PROGRESS_ONE)
+  uint32_t getProgressFixed() const;
+  
   // 设置完成回调
-  void setOnComplete(std::function<void()> callback);
+  void setOnComplete(AnimationCallback callback, void* context);
+  
+  // 释放动画：对象池中的动画归还槽位，其余直接 delete
+  void destroy();
   
 protected:
+  // 调用完成回调
+  void complete();
+  
   AnimationState state;       // 当前状态
   unsigned long startTime;    // 开始时间
   unsigned long pauseTime;    // 暂停时间
   unsigned long duration;     // 持续时间
-  float progress;             // 进度 (0.0 - 1.0)
-  std::function<void()> onComplete; // 完成回调
+  uint32_t progress;          // 进度 (0 - ANIME_PROGRESS_ONE)
+  uint32_t progressScale;     // (1 << 24) / duration，在 start 时计算，update 中只做乘法
+  AnimationCallback onComplete; // 完成回调
+  void* onCompleteContext;      // 完成回调的上下文
+  
+private:
+  template <class T, int N> friend class AnimationPool;
+  void (*releaseHook)(Animation* animation); // 由对象池设置
 };
 
+// 完成回调的通用实现：context 指向动画持有的 std::function，取出后调用一次
+void runAnimationCallback(void* context);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "AnimationEasing.h"
+
+// 缓动曲线在 [0,1] 上等距采样 64 段，采样值为 Q16 定点数，表放在 Flash 中
+#define EASING_TABLE_BITS 6
+#define EASING_TABLE_SIZE ((1 << EASING_TABLE_BITS) + 1)
+#define EASING_FRACTION_BITS (16 - EASING_TABLE_BITS)
+
+// t^3
+static const int32_t easeInCubicTable[EASING_TABLE_SIZE] = {
+  0, 0, 2, 7, 16, 31, 54, 86,
+  128, 182, 250, 333, 432, 549, 686, 844,
+  1024, 1228, 1458, 1715, 2000, 2315, 2662, 3042,
+  3456, 3906, 4394, 4921, 5488, 6097, 6750, 7448,
+  8192, 8984, 9826, 10719, 11664, 12663, 13718, 14830,
+  16000, 17230, 18522, 19877, 21296, 22781, 24334, 25956,
+  27648, 29412, 31250, 33163, 35152, 37219, 39366, 41594,
+  43904, 46298, 48778, 51345, 54000, 56745, 59582, 62512,
+  65536
+};
+
+// (t-1)^3 + 1
+static const int32_t easeOutCubicTable[EASING_TABLE_SIZE] = {
+  0, 3024, 5954, 8791, 11536, 14191, 16758, 19238,
+  21632, 23942, 26170, 28317, 30384, 32373, 34286, 36124,
+  37888, 39580, 41202, 42755, 44240, 45659, 47014, 48306,
+  49536, 50706, 51818, 52873, 53872, 54817, 55710, 56552,
+  57344, 58088, 58786, 59439, 60048, 60615, 61142, 61630,
+  62080, 62494, 62874, 63221, 63536, 63821, 64078, 64308,
+  64512, 64692, 64850, 64987, 65104, 65203, 65286, 65354,
+  65408, 65450, 65482, 65505, 65520, 65529, 65534, 65536,
+  65536
+};
+
+// 标准 easeOutBounce 分段抛物线
+static const int32_t easeOutBounceTable[EASING_TABLE_SIZE] = {
+  0, 121, 484, 1089, 1936, 3025, 4356, 5929,
+  7744, 9801, 12100, 14641, 17424, 20449, 23716, 27225,
+  30976, 34969, 39204, 43681, 48400, 53361, 58564, 64009,
+  63552, 61033, 58756, 56721, 54928, 53377, 52068, 51001,
+  50176, 49593, 49252, 49153, 49296, 49681, 50308, 51177,
+  52288, 53641, 55236, 57073, 59152, 61473, 64036, 64921,
+  63744, 62809, 62116, 61665, 61456, 61489, 61764, 62281,
+  63040, 64041, 65284, 65041, 64656, 64513, 64612, 64953,
+  65536
+};
+
+// 1 + 2.70158(t-1)^3 + 1.70158(t-1)^2，中段超过 1.0
+static const int32_t easeOutBackTable[EASING_TABLE_SIZE] = {
+  0, 4713, 9224, 13539, 17662, 21595, 25344, 28913,
+  32304, 35524, 38575, 41461, 44187, 46757, 49175, 51444,
+  53570, 55555, 57404, 59122, 60711, 62177, 63523, 64753,
+  65871, 66882, 67789, 68597, 69309, 69929, 70463, 70913,
+  71283, 71579, 71803, 71960, 72054, 72089, 72070, 71999,
+  71881, 71721, 71521, 71288, 71023, 70732, 70418, 70086,
+  69739, 69382, 69019, 68653, 68289, 67931, 67583, 67249,
+  66933, 66638, 66370, 66132, 65928, 65763, 65639, 65563,
+  65536
+};
+
+static int32_t lookupEasing(const int32_t* table, uint32_t progress) {
+  const uint32_t index = progress >> EASING_FRACTION_BITS;
+  const int32_t fraction = progress & ((1 << EASING_FRACTION_BITS) - 1);
+  const int32_t from = table[index];
+  const int32_t to = table[index + 1];
+  // 相邻采样间线性插值
+  return from + (((to - from) * fraction) >> EASING_FRACTION_BITS);
+}
+
+int32_t easeFixed(EasingType type, uint32_t progress) {
+  if (progress >= ANIME_PROGRESS_ONE) {
+    return ANIME_PROGRESS_ONE;
+  }
+
+  switch (type) {
+    case EASE_IN_CUBIC:
+      return lookupEasing(easeInCubicTable, progress);
+    case EASE_OUT_CUBIC:
+      return lookupEasing(easeOutCubicTable, progress);
+    case EASE_OUT_BOUNCE:
+      return lookupEasing(easeOutBounceTable, progress);
+    case EASE_OUT_BACK:
+      return lookupEasing(easeOutBackTable, progress);
+    case EASE_LINEAR:
+    default:
+      return progress;
+  }
+}
@@ -0,0 +1,25 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef AnimationEasing_h
+#define AnimationEasing_h
+
+#include <Arduino.h>
+#include "Animation.h"
+
+// 缓动曲线类型
+enum EasingType {
+  EASE_LINEAR,
+  EASE_IN_CUBIC,
+  EASE_OUT_CUBIC,
+  EASE_OUT_BOUNCE,
+  EASE_OUT_BACK      // 带回弹，中段会超过 ANIME_PROGRESS_ONE
+};
+
+// 查表计算缓动值，输入输出均为 Q16 定点数（ANIME_PROGRESS_ONE 表示 1.0）
+int32_t easeFixed(EasingType type, uint32_t progress);
+
+#endif
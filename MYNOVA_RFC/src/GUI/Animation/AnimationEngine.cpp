@@ -5,73 +5,139 @@
 */
 
 #include "AnimationEngine.h"
+#include "../UIEngine.h"
+
+extern UIEngine uiEngine;
 
 // 创建全局动画引擎实例
 AnimationEngine animationEngine;
 
 // AnimationEngine 类实现
 AnimationEngine::AnimationEngine() {
+  this->animationCount = 0;
+  this->lock = portMUX_INITIALIZER_UNLOCKED;
 }
 
 AnimationEngine::~AnimationEngine() {
   this->clearAnimations();
 }
 
-// 修改 update 方法，使其返回 bool 类型
 void AnimationEngine::update() {
-  if (this->animations.empty()) {
+  if (this->animationCount == 0) {
     return;
   }
 
-  // 创建当前动画列表的副本（避免在遍历时因回调添加新动画而导致迭代器失效）
-  std::vector<Animation*> currentAnimations = this->animations;
-  std::vector<Animation*> toDelete;
+  // 在栈上复制当前动画列表（避免回调中添加或移除动画影响遍历）
+  Animation* currentAnimations[ANIMATION_ENGINE_MAX_ANIMATIONS];
+  Animation* toDelete[ANIMATION_ENGINE_MAX_ANIMATIONS];
+  int currentCount = 0;
+  int deleteCount = 0;
+
+  portENTER_CRITICAL(&this->lock);
+  currentCount = this->animationCount;
+  memcpy(currentAnimations, this->animations, currentCount * sizeof(Animation*));
+  portEXIT_CRITICAL(&this->lock);
   
   // 遍历并更新所有动画（使用副本）
-  for (auto anim : currentAnimations) {
+  for (int i = 0; i < currentCount; i++) {
+    Animation* anim = currentAnimations[i];
     // 检查动画是否仍在列表中（可能已被其他操作删除）
-    if (std::find(this->animations.begin(), this->animations.end(), anim) != this->animations.end()) {
+    if (this->contains(anim)) {
       anim->update();
       
       // 如果动画已完成，标记为待删除
       if (anim->getState() == ANIME_STATE_FINISHED) {
-        toDelete.push_back(anim);
+        toDelete[deleteCount++] = anim;
       }
     }
   }
   
   // 删除已完成的动画
-  for (auto anim : toDelete) {
-    auto it = std::find(this->animations.begin(), this->animations.end(), anim);
-    if (it != this->animations.end()) {
-      this->animations.erase(it);
+  for (int i = 0; i < deleteCount; i++) {
+    if (this->detach(toDelete[i])) {
+      toDelete[i]->destroy();
     }
-    delete anim;
   }
 }
 
 void AnimationEngine::addAnimation(Animation* animation) {
-  if (animation != nullptr) {
-    this->animations.push_back(animation);
-    animation->start();
+  if (animation == nullptr) {
+    return;
+  }
+
+  // 先启动再加入列表，渲染任务不会看到未启动的动画
+  animation->start();
+
+  bool added = false;
+  portENTER_CRITICAL(&this->lock);
+  if (this->animationCount < ANIMATION_ENGINE_MAX_ANIMATIONS) {
+    this->animations[this->animationCount++] = animation;
+    added = true;
   }
+  portEXIT_CRITICAL(&this->lock);
+
+  if (!added) {
+    Serial.println("AnimationEngine: too many animations, dropped");
+    animation->destroy();
+    return;
+  }
+
+  // 唤醒空闲等待中的渲染任务，动画结束前保持连续渲染
+  uiEngine.requestRedraw();
 }
 
 void AnimationEngine::removeAnimation(Animation* animation) {
-  auto it = std::find(this->animations.begin(), this->animations.end(), animation);
-  if (it != this->animations.end()) {
-    delete *it; // 删除动画对象
-    this->animations.erase(it); // 从列表中移除
+  if (this->detach(animation)) {
+    animation->destroy(); // 删除动画对象
   }
 }
 
 void AnimationEngine::clearAnimations() {
-  for (auto anim : animations) {
-    delete anim;
+  Animation* removed[ANIMATION_ENGINE_MAX_ANIMATIONS];
+  int removedCount = 0;
+
+  portENTER_CRITICAL(&this->lock);
+  removedCount = this->animationCount;
+  memcpy(removed, this->animations, removedCount * sizeof(Animation*));
+  this->animationCount = 0;
+  portEXIT_CRITICAL(&this->lock);
+
+  for (int i = 0; i < removedCount; i++) {
+    removed[i]->destroy();
   }
-  animations.clear();
 }
 
 bool AnimationEngine::isAnimating() {
-  return !this->animations.empty();
-}
\ No newline at end of file
+  return this->animationCount > 0;
+}
+
+bool AnimationEngine::detach(Animation* animation) {
+  bool found = false;
+  portENTER_CRITICAL(&this->lock);
+  for (int i = 0; i < this->animationCount; i++) {
+    if (this->animations[i] == animation) {
+      // 保持添加顺序，后面的动画前移
+      for (int j = i + 1; j < this->animationCount; j++) {
+        this->animations[j - 1] = this->animations[j];
+      }
+      this->animationCount--;
+      found = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&this->lock);
+  return found;
+}
+
+bool AnimationEngine::contains(Animation* animation) {
+  bool found = false;
+  portENTER_CRITICAL(&this->lock);
+  for (int i = 0; i < this->animationCount; i++) {
+    if (this->animations[i] == animation) {
+      found = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&this->lock);
+  return found;
+}
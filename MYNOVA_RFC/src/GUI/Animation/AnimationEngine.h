@@ -10,7 +10,10 @@
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include "Animation.h"
-#include <vector>
+#include "AnimationPool.h"
+
+// 同时运行的动画数量上限
+#define ANIMATION_ENGINE_MAX_ANIMATIONS 24
 
 // 动画引擎类
 class AnimationEngine {
@@ -30,9 +33,15 @@ public:
   bool isAnimating();
   
 private:
-  std::vector<Animation*> animations; // 当前动画
+  // 从列表中摘除动画，返回是否找到
+  bool detach(Animation* animation);
+  bool contains(Animation* animation);
+
+  Animation* animations[ANIMATION_ENGINE_MAX_ANIMATIONS]; // 当前动画
+  int animationCount;
+  portMUX_TYPE lock; // 动画可能由渲染任务以外的任务添加
 };
 
 extern AnimationEngine animationEngine;
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,75 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef AnimationPool_h
+#define AnimationPool_h
+
+#include <Arduino.h>
+#include <new>
+#include <utility>
+#include "Animation.h"
+
+// 固定容量的动画对象池：每种动画类型预留 N 个静态槽位，
+// 槽位用完时退回堆分配，保证功能不受影响
+template <class T, int N>
+class AnimationPool {
+public:
+  template <class... Args>
+  static T* acquire(Args&&... args) {
+    int index = -1;
+    portENTER_CRITICAL(&lock);
+    for (int i = 0; i < N; i++) {
+      if (!used[i]) {
+        used[i] = true;
+        index = i;
+        break;
+      }
+    }
+    portEXIT_CRITICAL(&lock);
+
+    if (index < 0) {
+      Serial.println("AnimationPool: pool exhausted, fallback to heap");
+      return new T(std::forward<Args>(args)...);
+    }
+
+    T* animation = new (slots[index].data) T(std::forward<Args>(args)...);
+    static_cast<Animation*>(animation)->releaseHook = &AnimationPool::release;
+    return animation;
+  }
+
+private:
+  struct Slot {
+    alignas(T) uint8_t data[sizeof(T)];
+  };
+
+  static void release(Animation* animation) {
+    T* object = static_cast<T*>(animation);
+    for (int i = 0; i < N; i++) {
+      if (object == reinterpret_cast<T*>(slots[i].data)) {
+        object->~T();
+        portENTER_CRITICAL(&lock);
+        used[i] = false;
+        portEXIT_CRITICAL(&lock);
+        return;
+      }
+    }
+  }
+
+  static Slot slots[N];
+  static bool used[N];
+  static portMUX_TYPE lock;
+};
+
+template <class T, int N>
+typename AnimationPool<T, N>::Slot AnimationPool<T, N>::slots[N];
+
+template <class T, int N>
+bool AnimationPool<T, N>::used[N];
+
+template <class T, int N>
+portMUX_TYPE AnimationPool<T, N>::lock = portMUX_INITIALIZER_UNLOCKED;
+
+#endif
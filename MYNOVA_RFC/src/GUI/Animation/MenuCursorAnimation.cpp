@@ -17,14 +17,14 @@ MenuCursorAnimation::~MenuCursorAnimation() {
   // 析构函数
 }
 
-float MenuCursorAnimation::getCurrentPosition() {
-  return this->fromPos + (this->toPos - this->fromPos) * this->progress;
+int MenuCursorAnimation::getCurrentPosition() {
+  return this->fromPos + (this->toPos - this->fromPos) * (int32_t)this->progress / ANIME_PROGRESS_ONE;
 }
 
 void MenuCursorAnimation::update() {
   Animation::update();
 
-  if (progress >= 1.0f) {
+  if (progress >= ANIME_PROGRESS_ONE) {
     // 动画结束，更新菜单的光标位置
     menu->menuSelY = toPos;
     stop();
@@ -18,7 +18,7 @@ public:
 
   void update() override;
   // 获取当前光标位置
-  float getCurrentPosition();
+  int getCurrentPosition();
   
 private:
   UIMenu* menu;         // 菜单对象
@@ -26,4 +26,7 @@ private:
   int toPos;            // 目标位置
 };
 
+// 光标动画对象池（快速连按时会有多个光标动画同时存在）
+typedef AnimationPool<MenuCursorAnimation, 4> MenuCursorAnimationPool;
+
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 
 #include "MessageBoxAnimation.h"
 #include "../Widget/UIMessageBox.h"
-#include <math.h>
+#include "AnimationEasing.h"
 
 MessageBoxAnimation::MessageBoxAnimation(UIMessageBox* msgBox, MessageBoxAnimationType type, unsigned long duration)
   : Animation(duration) {
@@ -122,114 +122,91 @@ void MessageBoxAnimation::setAnimationType(MessageBoxAnimationType type) {
   this->animType = type;
 }
 
-// 缓动函数
-float MessageBoxAnimation::easeOutCubic(float t) {
-  float f = t - 1.0f;
-  return f * f * f + 1.0f;
-}
-
-float MessageBoxAnimation::easeOutBounce(float t) {
-  if (t < (1.0f / 2.75f)) {
-    return 7.5625f * t * t;
-  } else if (t < (2.0f / 2.75f)) {
-    t -= (1.5f / 2.75f);
-    return 7.5625f * t * t + 0.75f;
-  } else if (t < (2.5f / 2.75f)) {
-    t -= (2.25f / 2.75f);
-    return 7.5625f * t * t + 0.9375f;
-  } else {
-    t -= (2.625f / 2.75f);
-    return 7.5625f * t * t + 0.984375f;
-  }
-}
-
-float MessageBoxAnimation::easeOutBack(float t) {
-  float c1 = 1.70158f;
-  float c3 = c1 + 1.0f;
-  return 1.0f + c3 * pow(t - 1.0f, 3.0f) + c1 * pow(t - 1.0f, 2.0f);
+// 定点数转换为渲染使用的浮点比例（乘以常量倒数，不做除法）
+static inline float toScale(int32_t value) {
+  return value * (1.0f / ANIME_PROGRESS_ONE);
 }
 
 // 更新各种动画效果
-void MessageBoxAnimation::updateZoomCenter(float progress) {
-  float easedProgress = easeOutCubic(progress);
-  scaleX = easedProgress;
-  scaleY = easedProgress;
-  alpha = progress;
+void MessageBoxAnimation::updateZoomCenter(uint32_t progress) {
+  int32_t easedProgress = easeFixed(EASE_OUT_CUBIC, progress);
+  scaleX = toScale(easedProgress);
+  scaleY = toScale(easedProgress);
+  alpha = toScale(progress);
   offsetX = 0;
   offsetY = 0;
 }
 
-void MessageBoxAnimation::updateZoomBottom(float progress) {
-  float easedProgress = easeOutBack(progress);
-  scaleX = easedProgress;
-  scaleY = easedProgress;
-  alpha = progress;
+void MessageBoxAnimation::updateZoomBottom(uint32_t progress) {
+  int32_t easedProgress = easeFixed(EASE_OUT_BACK, progress);
+  scaleX = toScale(easedProgress);
+  scaleY = toScale(easedProgress);
+  alpha = toScale(progress);
   
   // 从底部位置开始
   if (messageBox) {
     // 计算从底部向上的偏移
-    offsetY = (int)((1.0f - easedProgress) * 30);
+    offsetY = (ANIME_PROGRESS_ONE - easedProgress) * 30 / ANIME_PROGRESS_ONE;
   }
 }
 
-void MessageBoxAnimation::updateFadeIn(float progress) {
-  alpha = progress;
+void MessageBoxAnimation::updateFadeIn(uint32_t progress) {
+  alpha = toScale(progress);
   scaleX = 1.0f;
   scaleY = 1.0f;
   offsetX = 0;
   offsetY = 0;
 }
 
-void MessageBoxAnimation::updateDropDown(float progress) {
-  float easedProgress = easeOutBounce(progress);
-  offsetY = (int)(-50 * (1.0f - easedProgress));
-  alpha = progress;
+void MessageBoxAnimation::updateDropDown(uint32_t progress) {
+  int32_t easedProgress = easeFixed(EASE_OUT_BOUNCE, progress);
+  offsetY = -50 * (ANIME_PROGRESS_ONE - easedProgress) / ANIME_PROGRESS_ONE;
+  alpha = toScale(progress);
   scaleX = 1.0f;
   scaleY = 1.0f;
 }
 
-void MessageBoxAnimation::updateSlideUp(float progress) {
-  float easedProgress = easeOutCubic(progress);
-  offsetY = (int)(50 * (1.0f - easedProgress));
-  alpha = 0.8f + 0.2f * progress;
+void MessageBoxAnimation::updateSlideUp(uint32_t progress) {
+  int32_t easedProgress = easeFixed(EASE_OUT_CUBIC, progress);
+  offsetY = 50 * (ANIME_PROGRESS_ONE - easedProgress) / ANIME_PROGRESS_ONE;
+  alpha = 0.8f + 0.2f * toScale(progress);
   scaleX = 1.0f;
   scaleY = 1.0f;
 }
 
-void MessageBoxAnimation::updateBounceIn(float progress) {
-  float easedProgress = easeOutBounce(progress);
-  scaleX = easedProgress;
-  scaleY = easedProgress;
-  alpha = progress;
+void MessageBoxAnimation::updateBounceIn(uint32_t progress) {
+  int32_t easedProgress = easeFixed(EASE_OUT_BOUNCE, progress);
+  scaleX = toScale(easedProgress);
+  scaleY = toScale(easedProgress);
+  alpha = toScale(progress);
   offsetX = 0;
   offsetY = 0;
 }
 
 // 退出动画实现
-void MessageBoxAnimation::updateZoomOut(float progress) {
+void MessageBoxAnimation::updateZoomOut(uint32_t progress) {
   // 使用easeInCubic效果（反向的easeOutCubic）
-  float easedProgress = progress * progress * progress;
-  scaleX = 1.0f - easedProgress;
-  scaleY = 1.0f - easedProgress;
-  alpha = 1.0f - progress;
+  int32_t easedProgress = easeFixed(EASE_IN_CUBIC, progress);
+  scaleX = toScale(ANIME_PROGRESS_ONE - easedProgress);
+  scaleY = toScale(ANIME_PROGRESS_ONE - easedProgress);
+  alpha = toScale(ANIME_PROGRESS_ONE - progress);
   offsetX = 0;
   offsetY = 0;
 }
 
-void MessageBoxAnimation::updateFadeOut(float progress) {
-  alpha = 1.0f - progress;
+void MessageBoxAnimation::updateFadeOut(uint32_t progress) {
+  alpha = toScale(ANIME_PROGRESS_ONE - progress);
   scaleX = 1.0f;
   scaleY = 1.0f;
   offsetX = 0;
   offsetY = 0;
 }
 
-void MessageBoxAnimation::updateSlideDown(float progress) {
+void MessageBoxAnimation::updateSlideDown(uint32_t progress) {
   // 使用easeInCubic效果
-  float easedProgress = progress * progress * progress;
-  offsetY = (int)(50 * easedProgress);
-  alpha = 1.0f - progress;
+  int32_t easedProgress = easeFixed(EASE_IN_CUBIC, progress);
+  offsetY = 50 * easedProgress / ANIME_PROGRESS_ONE;
+  alpha = toScale(ANIME_PROGRESS_ONE - progress);
   scaleX = 1.0f;
   scaleY = 1.0f;
 }
-
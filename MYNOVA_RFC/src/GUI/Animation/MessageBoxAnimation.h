@@ -8,6 +8,7 @@
 #define MessageBoxAnimation_h
 
 #include "Animation.h"
+#include "AnimationPool.h"
 
 // MessageBox动画类型
 enum MessageBoxAnimationType {
@@ -55,23 +56,21 @@ private:
   int offsetY;
   float alpha;
   
-  // 缓动函数
-  float easeOutCubic(float t);
-  float easeOutBounce(float t);
-  float easeOutBack(float t);
-  
-  // 更新动画参数
-  void updateZoomCenter(float progress);
-  void updateZoomBottom(float progress);
-  void updateFadeIn(float progress);
-  void updateDropDown(float progress);
-  void updateSlideUp(float progress);
-  void updateBounceIn(float progress);
+  // 更新动画参数（progress 为 Q16 定点进度）
+  void updateZoomCenter(uint32_t progress);
+  void updateZoomBottom(uint32_t progress);
+  void updateFadeIn(uint32_t progress);
+  void updateDropDown(uint32_t progress);
+  void updateSlideUp(uint32_t progress);
+  void updateBounceIn(uint32_t progress);
   // 退出动画
-  void updateZoomOut(float progress);
-  void updateFadeOut(float progress);
-  void updateSlideDown(float progress);
+  void updateZoomOut(uint32_t progress);
+  void updateFadeOut(uint32_t progress);
+  void updateSlideDown(uint32_t progress);
 };
 
+// 消息框动画对象池（退出动画可能在进入动画结束前开始）
+typedef AnimationPool<MessageBoxAnimation, 2> MessageBoxAnimationPool;
+
 #endif
 
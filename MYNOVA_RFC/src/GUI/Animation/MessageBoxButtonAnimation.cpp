@@ -18,6 +18,11 @@ MessageBoxButtonAnimation::~MessageBoxButtonAnimation() {
   // 析构函数
 }
 
+void MessageBoxButtonAnimation::setCompleteAction(std::function<void()> action) {
+  completeAction = std::move(action);
+  setOnComplete(runAnimationCallback, &completeAction);
+}
+
 void MessageBoxButtonAnimation::update() {
   if (this->state != ANIME_STATE_RUNNING) {
     return;
@@ -9,6 +9,7 @@
 #define MessageBoxButtonAnimation_h
 
 #include "Animation.h"
+#include "AnimationPool.h"
 
 // 前向声明
 class UIMessageBox;
@@ -27,10 +28,17 @@ public:
   
   void update() override;
   
+  // 设置完成后执行的操作：保存在本动画的槽位中，同一按钮连续触发时互不覆盖
+  void setCompleteAction(std::function<void()> action);
+  
 private:
   UIMessageBox* msgBox;  // 消息框对象
   MessageBoxButtonPosition buttonPosition;  // 按钮位置
+  std::function<void()> completeAction;  // 完成回调，由 runAnimationCallback 取出调用
 };
 
+// 消息框按钮动画对象池（左右按钮各一个）
+typedef AnimationPool<MessageBoxButtonAnimation, 2> MessageBoxButtonAnimationPool;
+
 #endif
 
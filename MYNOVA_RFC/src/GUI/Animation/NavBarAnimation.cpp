@@ -24,6 +24,11 @@ NavBarAnimation::~NavBarAnimation() {
   // 析构函数
 }
 
+void NavBarAnimation::setCompleteAction(std::function<void()> action) {
+  completeAction = std::move(action);
+  setOnComplete(runAnimationCallback, &completeAction);
+}
+
 void NavBarAnimation::update() {
   if (this->state != ANIME_STATE_RUNNING) {
     return;
@@ -124,9 +129,7 @@ void NavBarAnimation::update() {
             }
           }
           // 触发完成回调
-          if (this->onComplete) {
-            this->onComplete();
-          }
+          this->complete();
         }
       }
       break;
@@ -9,6 +9,7 @@
 #define NavBarAnimation_h
 
 #include "Animation.h"
+#include "AnimationPool.h"
 #include "../Widget/UINavBar.h"
 
 // 导航栏按钮位置枚举
@@ -38,6 +39,9 @@ public:
   // 设置为闪烁模式
   void setBlinkMode(int blinkCount = 3, unsigned long onDuration = 200, unsigned long offDuration = 200);
   
+  // 设置完成后执行的操作：保存在本动画的槽位中，同一按钮连续触发时互不覆盖
+  void setCompleteAction(std::function<void()> action);
+  
 private:
   UINavBar* navBar;  // 导航栏对象
   NavBarButtonPosition buttonPosition;  // 按钮位置
@@ -50,7 +54,12 @@ private:
   unsigned long offDuration;  // 熄灭持续时间
   bool isOn;              // 当前状态（高亮/熄灭）
   unsigned long stateStartTime;  // 当前状态开始时间
+  
+  std::function<void()> completeAction;  // 完成回调，由 runAnimationCallback 取出调用
 };
 
+// 导航栏动画对象池（左中右按钮各一个，另留一个给重复按下）
+typedef AnimationPool<NavBarAnimation, 4> NavBarAnimationPool;
+
 #endif
 
@@ -61,12 +61,12 @@ void PageTransition::update() {
       this->pageZoom();
       break;
     default:
-        progress = 1.0f;
+        progress = ANIME_PROGRESS_ONE;
         stop();
       break;
   }
   // 检查动画是否结束，如果结束则更新外部指针
-  if (this->progress >= 1.0f) {
+  if (this->progress >= ANIME_PROGRESS_ONE) {
     fromPage = toPage;
     toPage = nullptr;
     
@@ -94,25 +94,27 @@ void PageTransition::update() {
 
 // 替换 pushMatrix 和 popMatrix 方法
 void PageTransition::pageSlide() {
-  int width = toPage->pageWidth;
-  int height = toPage->pageHeight;
+  const int32_t width = toPage->pageWidth;
+  const int32_t height = toPage->pageHeight;
+  const int32_t done = this->progress;
+  const int32_t remaining = ANIME_PROGRESS_ONE - done;
   
   // 计算偏移量
   switch (this->type) {
     case ANIME_SLIDE_IN_LEFT:  // 从右向左滑动
-      toPage->pageX = (int)((1.0f - this->progress) * width);
+      toPage->pageX = remaining * width / ANIME_PROGRESS_ONE;
       break;
       
     case ANIME_SLIDE_IN_RIGHT:  // 从左向右滑动
-      toPage->pageX = (int)(this->progress * width);
+      toPage->pageX = done * width / ANIME_PROGRESS_ONE;
       break;
       
     case ANIME_SLIDE_IN_UP:  // 从下向上滑动
-      toPage->pageY = (int)((1.0f - this->progress) * height);
+      toPage->pageY = remaining * height / ANIME_PROGRESS_ONE;
       break;
       
     case ANIME_SLIDE_IN_DOWN:  // 从上向下滑动
-      toPage->pageY = (int)(this->progress * height);
+      toPage->pageY = done * height / ANIME_PROGRESS_ONE;
       break;
       
     default:
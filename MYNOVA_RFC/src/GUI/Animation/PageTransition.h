@@ -38,4 +38,7 @@ private:
   void pageZoom();
 };
 
+// 页面过渡动画对象池（过渡期间可能再次导航）
+typedef AnimationPool<PageTransition, 2> PageTransitionPool;
+
 #endif
\ No newline at end of file
@@ -8,6 +8,7 @@
 #define QuickButtonAnimation_h
 
 #include "Animation.h"
+#include "AnimationPool.h"
 #include "../Widget/UIQuickButton.h"
 
 // 按钮动画类型枚举
@@ -43,4 +44,7 @@ private:
   unsigned long stateStartTime;  // 当前状态开始时间
 };
 
+// 快捷按钮动画对象池（连续按下不同按钮时闪烁会重叠）
+typedef AnimationPool<QuickButtonAnimation, 3> QuickButtonAnimationPool;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,231 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "FrameProfiler.h"
+#include <algorithm>
+
+// 创建全局帧耗时分析实例
+FrameProfiler frameProfiler;
+
+void TimingWindow::reset() {
+  count = 0;
+  pos = 0;
+}
+
+void TimingWindow::add(uint32_t micros) {
+  samples[pos] = micros > 0xFFFF ? 0xFFFF : (uint16_t)micros;
+  pos = (pos + 1) % FRAME_PROFILER_WINDOW;
+  if (count < FRAME_PROFILER_WINDOW) {
+    count++;
+  }
+}
+
+TimingStats TimingWindow::getStats() const {
+  TimingStats stats = {0};
+  stats.count = count;
+  if (count == 0) {
+    return stats;
+  }
+
+  uint16_t sorted[FRAME_PROFILER_WINDOW];
+  memcpy(sorted, samples, count * sizeof(uint16_t));
+  std::sort(sorted, sorted + count);
+
+  uint32_t total = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    total += sorted[i];
+  }
+  stats.minMicros = sorted[0];
+  stats.maxMicros = sorted[count - 1];
+  stats.avgMicros = total / count;
+  // 最近排名法：第 ceil(0.99 * n) 个采样
+  stats.p99Micros = sorted[(count * 99 + 99) / 100 - 1];
+  return stats;
+}
+
+FrameProfiler::FrameProfiler() {
+  lock = portMUX_INITIALIZER_UNLOCKED;
+  overlayEnabled = false;
+  reset();
+}
+
+void FrameProfiler::reset() {
+  portENTER_CRITICAL(&lock);
+  for (int i = 0; i < FRAME_PROFILER_MAX_PAGES; i++) {
+    pages[i].name = nullptr;
+    pages[i].frames = 0;
+    pages[i].lastUsed = 0;
+    pages[i].update.reset();
+    pages[i].render.reset();
+  }
+  frameTimes.reset();
+  transferTimes.reset();
+  inputLatency.reset();
+  lastInputLatency = 0;
+  useCounter = 0;
+  fpsWindowStart = millis();
+  fpsWindowFrames = 0;
+  fps = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+// 页面名称是各页面类中的字符串常量，先比较指针再比较内容
+FrameProfiler::PageProfile* FrameProfiler::findPage(const char* pageName) {
+  PageProfile* oldest = &pages[0];
+  for (int i = 0; i < FRAME_PROFILER_MAX_PAGES; i++) {
+    PageProfile* page = &pages[i];
+    if (page->name == pageName || (page->name != nullptr && strcmp(page->name, pageName) == 0)) {
+      page->lastUsed = ++useCounter;
+      return page;
+    }
+    if (page->lastUsed < oldest->lastUsed) {
+      oldest = page;
+    }
+  }
+
+  // 新页面：占用空位或替换最久未使用的页面
+  oldest->name = pageName;
+  oldest->frames = 0;
+  oldest->lastUsed = ++useCounter;
+  oldest->update.reset();
+  oldest->render.reset();
+  return oldest;
+}
+
+void FrameProfiler::recordUpdate(const char* pageName, uint32_t micros) {
+  portENTER_CRITICAL(&lock);
+  findPage(pageName)->update.add(micros);
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameProfiler::recordRender(const char* pageName, uint32_t micros) {
+  portENTER_CRITICAL(&lock);
+  PageProfile* page = findPage(pageName);
+  page->render.add(micros);
+  page->frames++;
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameProfiler::recordFrame(uint32_t micros) {
+  const uint32_t now = millis();
+  portENTER_CRITICAL(&lock);
+  frameTimes.add(micros);
+  fpsWindowFrames++;
+  // 每秒更新一次帧率；按需渲染时空闲页面的帧率会很低
+  if (now - fpsWindowStart >= 1000) {
+    fps = fpsWindowFrames * 1000.0f / (now - fpsWindowStart);
+    fpsWindowStart = now;
+    fpsWindowFrames = 0;
+  }
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameProfiler::recordTransfer(uint32_t micros) {
+  portENTER_CRITICAL(&lock);
+  transferTimes.add(micros);
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameProfiler::recordInputLatency(uint32_t micros) {
+  portENTER_CRITICAL(&lock);
+  inputLatency.add(micros >> FRAME_PROFILER_LATENCY_SHIFT);
+  lastInputLatency = micros;
+  portEXIT_CRITICAL(&lock);
+}
+
+void FrameProfiler::setOverlayEnabled(bool enabled) {
+  overlayEnabled = enabled;
+}
+
+bool FrameProfiler::isOverlayEnabled() {
+  return overlayEnabled;
+}
+
+void FrameProfiler::drawOverlay(U8G2* u8g2) {
+  portENTER_CRITICAL(&lock);
+  TimingWindow frames = frameTimes;
+  const float currentFps = fps;
+  portEXIT_CRITICAL(&lock);
+
+  const TimingStats stats = frames.getStats();
+  char text[20];
+  snprintf(text, sizeof(text), "%.0f %.1fms", currentFps, stats.avgMicros / 1000.0f);
+
+  // 页面可能只在 showPage 中设置一次字体，绘制后恢复原来的字体和颜色
+  const uint8_t* savedFont = u8g2->getU8g2()->font;
+  const uint8_t savedColor = u8g2->getDrawColor();
+
+  u8g2->setFont(u8g2_font_4x6_tr);
+  const int width = u8g2->getStrWidth(text) + 2;
+  const int x = u8g2->getDisplayWidth() - width;
+  u8g2->setDrawColor(0);
+  u8g2->drawBox(x, 0, width, 7);
+  u8g2->setDrawColor(1);
+  u8g2->drawStr(x + 1, 6, text);
+
+  if (savedFont != nullptr) {
+    u8g2->setFont(savedFont);
+  }
+  u8g2->setDrawColor(savedColor);
+}
+
+void FrameProfiler::reportStats(JsonObject item, const TimingStats& stats) {
+  item["samples"] = stats.count;
+  item["minMicros"] = stats.minMicros;
+  item["avgMicros"] = stats.avgMicros;
+  item["p99Micros"] = stats.p99Micros;
+  item["maxMicros"] = stats.maxMicros;
+}
+
+void FrameProfiler::report(JsonDocument& doc) {
+  // 在锁内只复制采样，排序统计在锁外进行
+  portENTER_CRITICAL(&lock);
+  TimingWindow frames = frameTimes;
+  TimingWindow transfers = transferTimes;
+  TimingWindow latency = inputLatency;
+  const uint32_t lastLatency = lastInputLatency;
+  const float currentFps = fps;
+  portEXIT_CRITICAL(&lock);
+
+  doc["fps"] = currentFps;
+  doc["overlay"] = overlayEnabled;
+  reportStats(doc["frame"].to<JsonObject>(), frames.getStats());
+  reportStats(doc["transfer"].to<JsonObject>(), transfers.getStats());
+
+  // 延迟采样按 FRAME_PROFILER_LATENCY_SHIFT 存储，报告时换算回微秒
+  TimingStats latencyStats = latency.getStats();
+  latencyStats.minMicros <<= FRAME_PROFILER_LATENCY_SHIFT;
+  latencyStats.avgMicros <<= FRAME_PROFILER_LATENCY_SHIFT;
+  latencyStats.p99Micros <<= FRAME_PROFILER_LATENCY_SHIFT;
+  latencyStats.maxMicros <<= FRAME_PROFILER_LATENCY_SHIFT;
+  JsonObject input = doc["inputLatency"].to<JsonObject>();
+  reportStats(input, latencyStats);
+  input["lastMicros"] = lastLatency;
+
+  JsonArray pageArray = doc["pages"].to<JsonArray>();
+  for (int i = 0; i < FRAME_PROFILER_MAX_PAGES; i++) {
+    portENTER_CRITICAL(&lock);
+    const char* name = pages[i].name;
+    const uint32_t pageFrames = pages[i].frames;
+    TimingWindow update = pages[i].update;
+    TimingWindow render = pages[i].render;
+    portEXIT_CRITICAL(&lock);
+
+    if (name == nullptr) {
+      continue;
+    }
+    JsonObject item = pageArray.add<JsonObject>();
+    item["name"] = name;
+    item["frames"] = pageFrames;
+    reportStats(item["update"].to<JsonObject>(), update.getStats());
+    const TimingStats renderStats = render.getStats();
+    reportStats(item["render"].to<JsonObject>(), renderStats);
+    if (renderStats.avgMicros > 0) {
+      // 页面渲染吞吐量：按平均耗时折算的每秒可渲染次数
+      item["rendersPerSec"] = 1000000.0f / renderStats.avgMicros;
+    }
+  }
+}
@@ -0,0 +1,91 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef FrameProfiler_h
+#define FrameProfiler_h
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <ArduinoJson.h>
+
+// 每个统计窗口保留的最近采样数
+#define FRAME_PROFILER_WINDOW 128
+// 同时统计的页面类数量，超出时替换最久未渲染的页面
+#define FRAME_PROFILER_MAX_PAGES 8
+// 按键延迟以 8us 为单位存储，窗口可记录约 524ms 以内的延迟
+#define FRAME_PROFILER_LATENCY_SHIFT 3
+
+// 一个窗口内的耗时统计（微秒），p99 按最近排名法取值
+struct TimingStats {
+  uint16_t count;
+  uint32_t minMicros;
+  uint32_t avgMicros;
+  uint32_t p99Micros;
+  uint32_t maxMicros;
+};
+
+// 固定长度的耗时采样环形缓冲区
+class TimingWindow {
+public:
+  void reset();
+  void add(uint32_t micros);
+  TimingStats getStats() const;
+
+private:
+  uint16_t samples[FRAME_PROFILER_WINDOW]; // 超过65535us的采样按65535记录
+  uint16_t count;
+  uint16_t pos;
+};
+
+// 帧耗时分析：按页面类统计 update/render 耗时，全局统计帧耗时、屏幕传输耗时与帧率
+class FrameProfiler {
+public:
+  FrameProfiler();
+
+  // 由渲染任务和传输任务调用
+  void recordUpdate(const char* pageName, uint32_t micros);
+  void recordRender(const char* pageName, uint32_t micros);
+  void recordFrame(uint32_t micros);
+  void recordTransfer(uint32_t micros);
+  // 按下按键到对应帧发送到屏幕的耗时，由传输任务调用
+  void recordInputLatency(uint32_t micros);
+
+  // 在屏幕右上角绘制帧率与平均帧耗时
+  void drawOverlay(U8G2* u8g2);
+  void setOverlayEnabled(bool enabled);
+  bool isOverlayEnabled();
+
+  void reset();
+  void report(JsonDocument& doc);
+
+private:
+  struct PageProfile {
+    const char* name;
+    uint32_t frames;
+    uint32_t lastUsed;
+    TimingWindow update;
+    TimingWindow render;
+  };
+
+  PageProfile* findPage(const char* pageName);
+  static void reportStats(JsonObject item, const TimingStats& stats);
+
+  PageProfile pages[FRAME_PROFILER_MAX_PAGES];
+  TimingWindow frameTimes;
+  TimingWindow transferTimes;
+  TimingWindow inputLatency;
+  uint32_t lastInputLatency;
+  uint32_t useCounter;
+  uint32_t fpsWindowStart;
+  uint32_t fpsWindowFrames;
+  float fps;
+  bool overlayEnabled;
+  portMUX_TYPE lock;
+};
+
+extern FrameProfiler frameProfiler;
+
+#endif
@@ -0,0 +1,61 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "GlyphWidthCache.h"
+
+// 创建全局字形宽度缓存实例
+GlyphWidthCache glyphWidthCache;
+
+GlyphWidthCache::GlyphWidthCache() {
+  clear();
+}
+
+void GlyphWidthCache::clear() {
+  for (int i = 0; i < GLYPH_WIDTH_CACHE_SIZE; i++) {
+    entries[i].font = nullptr;
+    entries[i].encoding = 0;
+    entries[i].width = 0;
+  }
+}
+
+int GlyphWidthCache::getWidth(U8G2* u8g2, const uint8_t* font, uint16_t encoding) {
+  const uint32_t slot = (encoding ^ ((uint32_t)(uintptr_t)font >> 4)) & (GLYPH_WIDTH_CACHE_SIZE - 1);
+  Entry& entry = entries[slot];
+  if (entry.font == font && entry.encoding == encoding) {
+    return entry.width;
+  }
+
+  // 字体中没有的字形宽度为0，与 getUTF8Width 一致
+  entry.font = font;
+  entry.encoding = encoding;
+  entry.width = u8g2_GetGlyphWidth(u8g2->getU8g2(), encoding);
+  return entry.width;
+}
+
+int GlyphWidthCache::decodeUtf8(const char* text, int length, int pos, uint16_t* encoding) {
+  const uint8_t c = (uint8_t)text[pos];
+  int charLen = 1;
+  uint32_t code = c;
+  if ((c & 0xE0) == 0xC0) {
+    charLen = 2;
+    code = c & 0x1F;
+  } else if ((c & 0xF0) == 0xE0) {
+    charLen = 3;
+    code = c & 0x0F;
+  } else if ((c & 0xF8) == 0xF0) {
+    charLen = 4;
+    code = c & 0x07;
+  }
+  if (pos + charLen > length) {
+    charLen = length - pos;
+  }
+  for (int k = 1; k < charLen; k++) {
+    code = (code << 6) | ((uint8_t)text[pos + k] & 0x3F);
+  }
+  // u8g2 字体只支持16位编码，超出范围的字符按不存在处理
+  *encoding = code > 0xFFFF ? 0xFFFF : (uint16_t)code;
+  return charLen;
+}
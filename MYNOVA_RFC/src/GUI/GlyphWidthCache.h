@@ -0,0 +1,43 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef GlyphWidthCache_h
+#define GlyphWidthCache_h
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+// 缓存条目数（2的幂），每条8字节
+#define GLYPH_WIDTH_CACHE_SIZE 256
+
+/*
+ * 字形宽度缓存：按（字体，编码）缓存字形的横向步进宽度。
+ * 大字库（如 wqy12 gb2312）每次查找字形都要在字体数据中搜索，
+ * 缓存后测量文本宽度每个字符只需一次查表。直接映射，冲突时覆盖。
+ * 只在渲染任务中使用，不加锁。
+ */
+class GlyphWidthCache {
+public:
+  GlyphWidthCache();
+  // 返回字形宽度，调用前 u8g2 的当前字体必须是 font
+  int getWidth(U8G2* u8g2, const uint8_t* font, uint16_t encoding);
+  void clear();
+
+  // 从UTF-8文本 text[pos] 处解码一个字符，返回字节数（至少为1）
+  static int decodeUtf8(const char* text, int length, int pos, uint16_t* encoding);
+
+private:
+  struct Entry {
+    const uint8_t* font;
+    uint16_t encoding;
+    int8_t width;
+  };
+  Entry entries[GLYPH_WIDTH_CACHE_SIZE];
+};
+
+extern GlyphWidthCache glyphWidthCache;
+
+#endif
@@ -0,0 +1,89 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "PageSnapshot.h"
+
+PageSnapshot::PageSnapshot() {
+  this->page = nullptr;
+}
+
+void PageSnapshot::capture(U8G2* u8g2, UIPage* page) {
+  // 临时把 u8g2 的绘制目标换成快照缓冲区
+  u8g2_t* u8g2Struct = u8g2->getU8g2();
+  uint8_t* savedBuffer = u8g2Struct->tile_buf_ptr;
+  const int savedX = page->pageX;
+  const int savedY = page->pageY;
+
+  u8g2Struct->tile_buf_ptr = this->buffer;
+  memset(this->buffer, 0, PAGE_SNAPSHOT_SIZE);
+  page->pageX = 0;
+  page->pageY = 0;
+  page->render(u8g2);
+
+  page->pageX = savedX;
+  page->pageY = savedY;
+  u8g2Struct->tile_buf_ptr = savedBuffer;
+  this->page = page;
+}
+
+void PageSnapshot::invalidate() {
+  this->page = nullptr;
+}
+
+bool PageSnapshot::isCapturedFrom(UIPage* page) {
+  return this->page != nullptr && this->page == page;
+}
+
+void PageSnapshot::blitTo(uint8_t* target, int offsetX, int offsetY) {
+  if (offsetX <= -SCREEN_WIDTH || offsetX >= SCREEN_WIDTH ||
+      offsetY <= -SCREEN_HEIGHT || offsetY >= SCREEN_HEIGHT) {
+    return;
+  }
+
+  const int startX = max(offsetX, 0);
+  const int endX = min(offsetX + SCREEN_WIDTH, SCREEN_WIDTH);
+  const int width = endX - startX;
+
+  if (offsetY == 0) {
+    // 只有水平平移：每个分块行一次内存复制
+    for (int row = 0; row < SCREEN_TILE_HEIGHT; row++) {
+      memcpy(target + row * SCREEN_WIDTH + startX,
+             this->buffer + row * SCREEN_WIDTH + startX - offsetX, width);
+    }
+    return;
+  }
+
+  // 竖直平移：目标分块行由相邻两个源分块行移位拼成
+  const int rowShift = offsetY >> 3;    // 向下取整，负偏移同样适用
+  const int bitShift = offsetY & 7;
+  for (int row = 0; row < SCREEN_TILE_HEIGHT; row++) {
+    // 当前分块行中被快照覆盖的像素
+    const int coverTop = max(offsetY - row * 8, 0);
+    const int coverBottom = min(offsetY + SCREEN_HEIGHT - row * 8, 8);
+    if (coverTop >= coverBottom) {
+      continue;
+    }
+    const uint8_t mask = (uint8_t)((0xFF << coverTop) & (0xFF >> (8 - coverBottom)));
+
+    const int upperRow = row - rowShift - 1;  // 提供本行顶部像素的源分块行
+    const int lowerRow = row - rowShift;      // 提供本行其余像素的源分块行
+    const uint8_t* upper = (upperRow >= 0 && upperRow < SCREEN_TILE_HEIGHT) ? this->buffer + upperRow * SCREEN_WIDTH : nullptr;
+    const uint8_t* lower = (lowerRow >= 0 && lowerRow < SCREEN_TILE_HEIGHT) ? this->buffer + lowerRow * SCREEN_WIDTH : nullptr;
+    uint8_t* dest = target + row * SCREEN_WIDTH;
+
+    for (int x = startX; x < endX; x++) {
+      const int srcX = x - offsetX;
+      uint8_t value = 0;
+      if (lower != nullptr) {
+        value |= (uint8_t)(lower[srcX] << bitShift);
+      }
+      if (upper != nullptr && bitShift != 0) {
+        value |= (uint8_t)(upper[srcX] >> (8 - bitShift));
+      }
+      dest[x] = (dest[x] & ~mask) | (value & mask);
+    }
+  }
+}
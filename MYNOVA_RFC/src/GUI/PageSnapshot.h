@@ -0,0 +1,37 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef PageSnapshot_h
+#define PageSnapshot_h
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "UIPage.h"
+#include "../GUIRender.h"
+
+// 快照缓冲区大小：与 u8g2 全缓冲相同的 SSD1306 分块布局（每字节为竖直8像素，低位在上）
+#define PAGE_SNAPSHOT_SIZE (SCREEN_WIDTH * SCREEN_TILE_HEIGHT)
+
+// 页面快照：页面过渡期间把页面渲染一次到离屏缓冲区，之后每帧只做平移拼接
+class PageSnapshot {
+public:
+  PageSnapshot();
+
+  // 以 (0,0) 偏移把页面渲染到快照，不影响屏幕缓冲区
+  void capture(U8G2* u8g2, UIPage* page);
+  void invalidate();
+  // 快照是否来自该页面
+  bool isCapturedFrom(UIPage* page);
+
+  // 平移 (offsetX, offsetY) 后不透明地覆盖到目标缓冲区，移出屏幕的部分被裁剪
+  void blitTo(uint8_t* target, int offsetX, int offsetY);
+
+private:
+  uint8_t buffer[PAGE_SNAPSHOT_SIZE];
+  UIPage* page;
+};
+
+#endif
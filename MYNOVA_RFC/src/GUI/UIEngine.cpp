@@ -11,10 +11,12 @@
 #include "Animation/SelectionAnimation.h"
 #include "Animation/PageTransition.h"
 #include "../Pages/HomePage.h"
+#include "FrameProfiler.h"
 
 UIEngine::UIEngine() {
   this->currentPage = nullptr;
   this->nextPage = nullptr;
+  this->renderTaskHandle = nullptr;
 }
 
 UIEngine::~UIEngine() {
@@ -77,28 +79,98 @@ void UIEngine::processPendingDeletions() {
   Serial.flush();
 }
 
+void UIEngine::setRenderTask(TaskHandle_t taskHandle) {
+  this->renderTaskHandle = taskHandle;
+}
+
+void UIEngine::requestRedraw() {
+  // 通知计数相当于脏标记，多次请求在下一帧合并为一次绘制
+  if (this->renderTaskHandle != nullptr) {
+    xTaskNotifyGive(this->renderTaskHandle);
+  }
+}
+
+void UIEngine::requestRedrawFromISR(BaseType_t* higherPriorityTaskWoken) {
+  if (this->renderTaskHandle != nullptr) {
+    vTaskNotifyGiveFromISR(this->renderTaskHandle, higherPriorityTaskWoken);
+  }
+}
+
+bool UIEngine::isTransitioning() {
+  return this->nextPage != nullptr;
+}
+
+uint32_t UIEngine::getRefreshInterval() {
+  if (animationEngine.isAnimating() || this->nextPage != nullptr) {
+    return 0;
+  }
+  if (this->currentPage == nullptr) {
+    return UI_PAGE_REFRESH_INTERVAL;
+  }
+  uint32_t interval = this->currentPage->getRefreshInterval();
+  // 子页面（如弹出的菜单）有自己的定时逻辑时取较短的间隔
+  if (this->currentPage->subPage != nullptr) {
+    interval = min(interval, this->currentPage->subPage->getRefreshInterval());
+  }
+  return interval;
+}
+
 void UIEngine::render(U8G2* u8g2) {
   
-  if (this->currentPage != nullptr) {
-    // 渲染当前页面
-    this->currentPage->render(u8g2);
-  }
-  if (this->nextPage != nullptr) {
-    // 渲染下一个页面内容
-    this->nextPage->render(u8g2);
+  if (this->currentPage != nullptr && this->nextPage != nullptr) {
+    // 页面过渡中：拼接两个页面的快照
+    this->renderTransition(u8g2);
+  } else {
+    // 过渡结束后快照失效，页面指针可能被复用
+    this->outgoingSnapshot.invalidate();
+    this->incomingSnapshot.invalidate();
+
+    if (this->currentPage != nullptr) {
+      // 渲染当前页面
+      uint32_t start = micros();
+      this->currentPage->render(u8g2);
+      frameProfiler.recordRender(this->currentPage->getPageName(), micros() - start);
+    }
+    if (this->nextPage != nullptr) {
+      // 渲染下一个页面内容
+      uint32_t start = micros();
+      this->nextPage->render(u8g2);
+      frameProfiler.recordRender(this->nextPage->getPageName(), micros() - start);
+    }
   }
   
   // 渲染完成后，安全删除待删除的页面
   processPendingDeletions();
 }
 
+// 过渡开始时把两个页面各渲染一次到快照，之后每帧按页面偏移平移拼接，
+// 新页面不透明地覆盖在旧页面上方；过渡期间页面内容保持不变
+void UIEngine::renderTransition(U8G2* u8g2) {
+  if (!this->outgoingSnapshot.isCapturedFrom(this->currentPage)) {
+    uint32_t start = micros();
+    this->outgoingSnapshot.capture(u8g2, this->currentPage);
+    frameProfiler.recordRender(this->currentPage->getPageName(), micros() - start);
+  }
+  if (!this->incomingSnapshot.isCapturedFrom(this->nextPage)) {
+    uint32_t start = micros();
+    this->incomingSnapshot.capture(u8g2, this->nextPage);
+    frameProfiler.recordRender(this->nextPage->getPageName(), micros() - start);
+  }
+
+  uint8_t* buffer = u8g2->getBufferPtr();
+  this->outgoingSnapshot.blitTo(buffer, this->currentPage->pageX, this->currentPage->pageY);
+  this->incomingSnapshot.blitTo(buffer, this->nextPage->pageX, this->nextPage->pageY);
+}
+
 void UIEngine::update() {
+  uint32_t start = micros();
   // 更新动画引擎
   animationEngine.update();
   
   // 更新当前页面
   if (this->currentPage != nullptr) {
     this->currentPage->update();
+    frameProfiler.recordUpdate(this->currentPage->getPageName(), micros() - start);
   }
 }
 
@@ -117,7 +189,7 @@ void UIEngine::navigateTo(UIPage* page, AnimationType aniType) {
 
   // 创建页面过渡动画
   if (aniType != ANIME_NONE && this->currentPage != nullptr) {
-    PageTransition *pageTransition = new PageTransition(this->currentPage, this->nextPage, aniType, 300);
+    PageTransition *pageTransition = PageTransitionPool::acquire(this->currentPage, this->nextPage, aniType, 300);
     animationEngine.addAnimation(pageTransition);
   } else {
     // 无动画，直接切换
@@ -128,6 +200,7 @@ void UIEngine::navigateTo(UIPage* page, AnimationType aniType) {
       this->currentPage->showPage();
     }
   }
+  requestRedraw();
 }
 
 UIPage* UIEngine::navigateBack(AnimationType aniType) {
@@ -148,7 +221,7 @@ UIPage* UIEngine::navigateBack(AnimationType aniType) {
   if (aniType != ANIME_NONE && this->currentPage != nullptr) {
     Serial.println("navigateBack: with animation");
     // 第5个参数 true 表示动画完成后删除旧页面，第6个参数传入 this 用于延迟删除
-    PageTransition *pageTransition = new PageTransition(this->currentPage, this->nextPage, aniType, 300, true, this);
+    PageTransition *pageTransition = PageTransitionPool::acquire(this->currentPage, this->nextPage, aniType, 300, true, this);
     animationEngine.addAnimation(pageTransition);
   } else {
     Serial.println("navigateBack: no animation, delete now");
@@ -169,6 +242,7 @@ UIPage* UIEngine::navigateBack(AnimationType aniType) {
     }
   }
   
+  requestRedraw();
   return this->currentPage;
 }
 
@@ -215,7 +289,7 @@ void UIEngine::navigateBack(UIPage* targetPage, AnimationType aniType) {
   // 创建页面过渡动画
   if (aniType != ANIME_NONE && this->currentPage != nullptr) {
       // 第5个参数 true 表示动画完成后删除旧页面，第6个参数传入 this 用于延迟删除
-      PageTransition *pageTransition = new PageTransition(this->currentPage, this->nextPage, aniType, 300, true, this);
+      PageTransition *pageTransition = PageTransitionPool::acquire(this->currentPage, this->nextPage, aniType, 300, true, this);
       animationEngine.addAnimation(pageTransition);
   } else {
     // 无动画，保存要删除的旧页面
@@ -232,6 +306,7 @@ void UIEngine::navigateBack(UIPage* targetPage, AnimationType aniType) {
       markForDeletion(pageToDelete);
     }
   }
+  requestRedraw();
 }
 
 UIPage* UIEngine::navigateBackSteps(int steps, AnimationType aniType) {
@@ -285,7 +360,7 @@ UIPage* UIEngine::navigateBackSteps(int steps, AnimationType aniType) {
   // 创建页面过渡动画
   if (aniType != ANIME_NONE && this->currentPage != nullptr) {
     // 第5个参数 true 表示动画完成后删除旧页面，第6个参数传入 this 用于延迟删除
-    PageTransition *pageTransition = new PageTransition(this->currentPage, this->nextPage, aniType, 300, true, this);
+    PageTransition *pageTransition = PageTransitionPool::acquire(this->currentPage, this->nextPage, aniType, 300, true, this);
     animationEngine.addAnimation(pageTransition);
   } else {
     // 无动画，保存要删除的旧页面
@@ -303,6 +378,7 @@ UIPage* UIEngine::navigateBackSteps(int steps, AnimationType aniType) {
     }
   }
   
+  requestRedraw();
   return this->currentPage;
 }
 
@@ -315,6 +391,7 @@ void UIEngine::setCurrentPage(UIPage* page) {
   if (this->currentPage != nullptr) {
     this->currentPage->showPage();
   }
+  requestRedraw();
 }
 
 bool UIEngine::backSubPage(UIPage* page) {
@@ -13,6 +13,7 @@
 #include <vector>
 #include <U8g2lib.h>
 #include "Animation/Animation.h"
+#include "PageSnapshot.h"
 
 class UIEngine {
 public:
@@ -25,8 +26,17 @@ public:
   void navigateBack(UIPage* targetPage, AnimationType aniType = ANIME_NONE);
   UIPage* navigateBackSteps(int steps, AnimationType aniType = ANIME_NONE);  // 返回到堆栈中的第N个页面
   UIPage* getCurrentPage();
+  bool isTransitioning();   // 页面过渡动画进行中（currentPage 仍是旧页面）
   void setCurrentPage(UIPage* page);
   
+  // 按需渲染：请求渲染任务尽快绘制下一帧（可在任意任务中调用，不可在中断中调用）
+  void requestRedraw();
+  // 中断（或 FromISR 上下文）中使用的版本
+  void requestRedrawFromISR(BaseType_t* higherPriorityTaskWoken);
+  void setRenderTask(TaskHandle_t taskHandle);
+  // 渲染任务空闲等待的时间（毫秒），返回0表示有动画或页面需要连续渲染
+  uint32_t getRefreshInterval();
+
   // 延迟删除：在渲染帧结束后安全删除
   void markForDeletion(UIPage* page);
   void processPendingDeletions();
@@ -36,7 +46,12 @@ private:
   UIPage* nextPage;
   std::stack<UIPage*> pages;
   std::vector<UIPage*> pagesToDelete; // 待删除的页面队列
+  TaskHandle_t renderTaskHandle;      // 渲染任务，重绘请求通过任务通知唤醒它
+  // 页面过渡期间两个页面的快照，每次过渡只渲染一次
+  PageSnapshot outgoingSnapshot;
+  PageSnapshot incomingSnapshot;
   bool backSubPage(UIPage* page);
+  void renderTransition(U8G2* u8g2);
 };
 
 #endif
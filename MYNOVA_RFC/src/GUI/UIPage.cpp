@@ -64,6 +64,11 @@ void UIPage::update() {
   // 默认实现为空，子类可以重写此方法以执行页面更新逻辑
 }
 
+// 默认按固定间隔刷新，供页面中的定时逻辑（光标闪烁、状态轮询）使用
+uint32_t UIPage::getRefreshInterval() {
+  return UI_PAGE_REFRESH_INTERVAL;
+}
+
 // 实现按钮事件处理函数
 void UIPage::onButtonBack(void* context) {
   if (onButtonBackCallback) {
@@ -12,6 +12,9 @@
 #include <U8g2lib.h>
 #include "Widget/UIWidget.h"
 
+// 空闲页面的默认刷新间隔（毫秒）：没有重绘请求时，按该间隔执行一次 update/render
+#define UI_PAGE_REFRESH_INTERVAL 200
+
 // 前向声明
 class Animation;
 // 定义按钮事件回调函数类型
@@ -33,6 +36,12 @@ public:
   // 页面更新函数，在主循环中调用
   virtual void update();
 
+  // 页面类名，用于帧耗时统计（固件不启用RTTI）
+  virtual const char* getPageName() { return "UIPage"; }
+
+  // 空闲时的刷新间隔（毫秒），返回0表示需要连续渲染（如游戏页面）
+  virtual uint32_t getRefreshInterval();
+
    // 设置按钮回调函数
   void setOnButtonBack(ButtonCallback callback) { onButtonBackCallback = callback; }
   void setOnButtonMenu(ButtonCallback callback) { onButtonMenuCallback = callback; }
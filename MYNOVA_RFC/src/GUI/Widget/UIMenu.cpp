@@ -34,6 +34,7 @@ UIMenu::UIMenu(int x, int y, int width, int height,int menuLines)
 UIMenu::~UIMenu()
 {
     delete navBar;
+    delete[] cachedItems;
 }
 
 int UIMenu::selectIndex()
@@ -51,6 +52,66 @@ void UIMenu::removeMenuItem(int iIndex)
     items.remove(iIndex);
 }
 
+void UIMenu::setItemProvider(MenuItemCountProvider countProvider, MenuItemTextProvider textProvider)
+{
+    this->countProvider = countProvider;
+    this->textProvider = textProvider;
+    if (cachedItems == nullptr) {
+        cachedItems = new CachedItem[UIMENU_CACHE_ROWS];
+    }
+    invalidateItems();
+}
+
+void UIMenu::invalidateItems()
+{
+    if (cachedItems == nullptr) {
+        return;
+    }
+    for (int i = 0; i < UIMENU_CACHE_ROWS; i++) {
+        cachedItems[i].index = -1;
+    }
+}
+
+int UIMenu::itemCount()
+{
+    if (countProvider) {
+        return countProvider();
+    }
+    return items.size();
+}
+
+const char* UIMenu::itemText(int index)
+{
+    if (index < 0 || index >= itemCount()) {
+        return "";
+    }
+    // 行号对缓存行数取模直接定位，窗口滑动时只有新进入窗口的行需要生成
+    CachedItem& item = cachedItems[index % UIMENU_CACHE_ROWS];
+    if (item.index != index) {
+        item.text[0] = '\0';
+        textProvider(index, item.text, sizeof(item.text));
+        item.text[sizeof(item.text) - 1] = '\0';
+        item.index = index;
+    }
+    return item.text;
+}
+
+// 生成可见行上下的预取行，滚动一行时下一行已经准备好
+void UIMenu::prefetchItems()
+{
+    if (!textProvider) {
+        return;
+    }
+    const int count = itemCount();
+    int first = menuStart - UIMENU_PREFETCH_ROWS;
+    int last = menuStart + menuItemLines + UIMENU_PREFETCH_ROWS;
+    if (first < 0) first = 0;
+    if (last > count) last = count;
+    for (int i = first; i < last; i++) {
+        itemText(i);
+    }
+}
+
 void UIMenu::moveUp()
 {
     if(menuPos > 0)
@@ -63,11 +124,11 @@ void UIMenu::moveUp()
     }
     else
     {
-        menuStart = items.size() - menuItemLines;
+        menuStart = itemCount() - menuItemLines;
         menuPos = menuItemLines - 1;
     }
      // 添加往上移动动画
-    MenuCursorAnimation* anim = new MenuCursorAnimation(this, menuSelY, menuPos * menuLineHeight, 100);
+    MenuCursorAnimation* anim = MenuCursorAnimationPool::acquire(this, menuSelY, menuPos * menuLineHeight, 100);
     animationEngine.addAnimation(anim);
 }
 
@@ -77,7 +138,7 @@ void UIMenu::moveDown()
     {     
         menuPos++;
     }
-    else if(menuStart + menuItemLines < items.size())
+    else if(menuStart + menuItemLines < itemCount())
     {
         menuStart++;
     }
@@ -88,7 +149,7 @@ void UIMenu::moveDown()
     }
 
     // 添加往下移动动画
-    MenuCursorAnimation* anim = new MenuCursorAnimation(this, menuSelY, menuPos * menuLineHeight, 100);
+    MenuCursorAnimation* anim = MenuCursorAnimationPool::acquire(this, menuSelY, menuPos * menuLineHeight, 100);
     animationEngine.addAnimation(anim);
 }
 
@@ -151,8 +212,13 @@ void UIMenu::render(U8G2* u8g2,int offsetX, int offsetY) {
         menuItemLines--;
     for(int i = 0; i < menuItemLines; i++)
     {
-         u8g2->drawUTF8(offsetX + x + marginLeft, offsetY + y + itemStartY + menuLineHeight * i + strLineOffset, items.get(menuStart + i).c_str());
+         const int textY = offsetY + y + itemStartY + menuLineHeight * i + strLineOffset;
+         if (textProvider)
+            u8g2->drawUTF8(offsetX + x + marginLeft, textY, itemText(menuStart + i));
+         else
+            u8g2->drawUTF8(offsetX + x + marginLeft, textY, items.get(menuStart + i).c_str());
     }
+    prefetchItems();
     
     u8g2->setFontMode(0);
     u8g2->setDrawColor(1);
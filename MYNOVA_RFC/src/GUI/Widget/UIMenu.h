@@ -12,8 +12,20 @@
 #include <ArrayList.h>
 #include <U8g2lib.h>
 #include <vector>
+#include <functional>
 #include "UINavBar.h"
 
+// 虚拟列表：可见行上下各预取的行数
+#define UIMENU_PREFETCH_ROWS 2
+// 虚拟列表缓存的行数，需不少于 可见行数 + 2 * 预取行数
+#define UIMENU_CACHE_ROWS 8
+// 虚拟列表每行文字的最大字节数
+#define UIMENU_ITEM_TEXT_SIZE 64
+
+// 菜单项数量 / 按索引填充菜单项文字
+typedef std::function<int()> MenuItemCountProvider;
+typedef std::function<void(int index, char* buffer, size_t size)> MenuItemTextProvider;
+
 class UIMenu : public UIWidget {
 public:
   UIMenu(int x, int y, int width, int height, int menuLines);
@@ -22,6 +34,10 @@ public:
   int selectIndex();//获取当前选择的
   void addMenuItem(String item);
   void removeMenuItem(int iIndex);
+  // 虚拟列表：由回调按需提供菜单项，只生成可见行及预取窗口内的行，不再使用 addMenuItem
+  void setItemProvider(MenuItemCountProvider countProvider, MenuItemTextProvider textProvider);
+  void invalidateItems();//数据变化后丢弃已生成的行
+  int itemCount();
   void moveUp();//向上移动光标
   void moveDown();//向下移动光标
   UINavBar* getNavBar();
@@ -49,8 +65,19 @@ public:
     // String rightBtnTip;
     String titleText;
 private:
+  const char* itemText(int index);//虚拟列表的行文字
+  void prefetchItems();
+
   ArrayList<String> items;
   UINavBar* navBar;
+
+  struct CachedItem {
+    int index;//-1 表示空
+    char text[UIMENU_ITEM_TEXT_SIZE];
+  };
+  MenuItemCountProvider countProvider;
+  MenuItemTextProvider textProvider;
+  CachedItem* cachedItems = nullptr;//按 index % UIMENU_CACHE_ROWS 存放
 };
 
 #endif
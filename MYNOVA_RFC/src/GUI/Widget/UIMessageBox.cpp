@@ -286,12 +286,10 @@ void UIMessageBox::show(MessageBoxAnimationType animType, unsigned long animDura
   
   // 创建新动画
   if (animType != MSGBOX_ANIME_NONE) {
-    currentAnimation = new MessageBoxAnimation(this, animType, animDuration);
+    currentAnimation = MessageBoxAnimationPool::acquire(this, animType, animDuration);
     
     // 设置动画完成回调，在动画完成时清空指针（避免野指针）
-    currentAnimation->setOnComplete([this]() {
-      currentAnimation = nullptr;
-    });
+    currentAnimation->setOnComplete(onShowAnimationComplete, this);
     
     animationEngine.addAnimation(currentAnimation);
   }
@@ -308,14 +306,10 @@ void UIMessageBox::hide(bool animated) {
     currentAnimation = nullptr;
     
     // 创建退出动画（默认使用缩小消失效果）
-    currentAnimation = new MessageBoxAnimation(this, MSGBOX_ANIME_ZOOM_OUT, 200);
+    currentAnimation = MessageBoxAnimationPool::acquire(this, MSGBOX_ANIME_ZOOM_OUT, 200);
     
     // 设置动画完成回调，在动画完成后真正隐藏
-    currentAnimation->setOnComplete([this]() {
-      bVisible = false;
-      autoCloseEnabled = false;
-      currentAnimation = nullptr;
-    });
+    currentAnimation->setOnComplete(onHideAnimationComplete, this);
     
     animationEngine.addAnimation(currentAnimation);
   } else {
@@ -333,18 +327,26 @@ void UIMessageBox::hide(MessageBoxAnimationType animType, unsigned long animDura
   currentAnimation = nullptr;
   
   // 创建退出动画
-  currentAnimation = new MessageBoxAnimation(this, animType, animDuration);
+  currentAnimation = MessageBoxAnimationPool::acquire(this, animType, animDuration);
   
   // 设置动画完成回调，在动画完成后真正隐藏
-  currentAnimation->setOnComplete([this]() {
-    bVisible = false;
-    autoCloseEnabled = false;
-    currentAnimation = nullptr;
-  });
+  currentAnimation->setOnComplete(onHideAnimationComplete, this);
   
   animationEngine.addAnimation(currentAnimation);
 }
 
+void UIMessageBox::onShowAnimationComplete(void* context) {
+  UIMessageBox* msgBox = static_cast<UIMessageBox*>(context);
+  msgBox->currentAnimation = nullptr;
+}
+
+void UIMessageBox::onHideAnimationComplete(void* context) {
+  UIMessageBox* msgBox = static_cast<UIMessageBox*>(context);
+  msgBox->bVisible = false;
+  msgBox->autoCloseEnabled = false;
+  msgBox->currentAnimation = nullptr;
+}
+
 bool UIMessageBox::isVisible() {
   return bVisible;
 }
@@ -436,9 +438,9 @@ void UIMessageBox::showLeftButtonHighLight(std::function<void()> onComplete) {
   bLeftButtonHighLight = true;
   
   // 创建高亮动画并添加到动画引擎
-  MessageBoxButtonAnimation* highlightAnim = new MessageBoxButtonAnimation(this, MSGBOX_BUTTON_LEFT, 300);
+  MessageBoxButtonAnimation* highlightAnim = MessageBoxButtonAnimationPool::acquire(this, MSGBOX_BUTTON_LEFT, 300);
   if (onComplete) {
-    highlightAnim->setOnComplete(onComplete);
+    highlightAnim->setCompleteAction(std::move(onComplete));
   }
   animationEngine.addAnimation(highlightAnim);
 }
@@ -447,9 +449,9 @@ void UIMessageBox::showRightButtonHighLight(std::function<void()> onComplete) {
   bRightButtonHighLight = true;
   
   // 创建高亮动画并添加到动画引擎
-  MessageBoxButtonAnimation* highlightAnim = new MessageBoxButtonAnimation(this, MSGBOX_BUTTON_RIGHT, 300);
+  MessageBoxButtonAnimation* highlightAnim = MessageBoxButtonAnimationPool::acquire(this, MSGBOX_BUTTON_RIGHT, 300);
   if (onComplete) {
-    highlightAnim->setOnComplete(onComplete);
+    highlightAnim->setCompleteAction(std::move(onComplete));
   }
   animationEngine.addAnimation(highlightAnim);
 }
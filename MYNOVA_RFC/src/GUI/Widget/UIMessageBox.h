@@ -90,6 +90,10 @@ private:
   
   // 边界检查
   void clampToScreen();
+  
+  // 动画完成回调（context 为消息框自身）
+  static void onShowAnimationComplete(void* context);
+  static void onHideAnimationComplete(void* context);
 };
 
 #endif
@@ -136,9 +136,9 @@ void UINavBar::showLeftHighLight(std::function<void()> onComplete) {
     bLeftHighLight = true;
     
     // 创建高亮动画并添加到动画引擎
-    NavBarAnimation* highlightAnim = new NavBarAnimation(this, NAV_BUTTON_LEFT, 300);
+    NavBarAnimation* highlightAnim = NavBarAnimationPool::acquire(this, NAV_BUTTON_LEFT, 300);
     if (onComplete) {
-        highlightAnim->setOnComplete(onComplete);
+        highlightAnim->setCompleteAction(std::move(onComplete));
     }
     animationEngine.addAnimation(highlightAnim);
 }
@@ -148,9 +148,9 @@ void UINavBar::showMiddleHighLight(std::function<void()> onComplete) {
     bMiddleHighLight = true;
     
     // 创建高亮动画并添加到动画引擎
-    NavBarAnimation* highlightAnim = new NavBarAnimation(this, NAV_BUTTON_MIDDLE, 300);
+    NavBarAnimation* highlightAnim = NavBarAnimationPool::acquire(this, NAV_BUTTON_MIDDLE, 300);
     if (onComplete) {
-        highlightAnim->setOnComplete(onComplete);
+        highlightAnim->setCompleteAction(std::move(onComplete));
     }
     animationEngine.addAnimation(highlightAnim);
 }
@@ -160,9 +160,9 @@ void UINavBar::showRightHighLight(std::function<void()> onComplete) {
     bRightHighLight = true;
     
     // 创建高亮动画并添加到动画引擎
-    NavBarAnimation* highlightAnim = new NavBarAnimation(this, NAV_BUTTON_RIGHT, 300);
+    NavBarAnimation* highlightAnim = NavBarAnimationPool::acquire(this, NAV_BUTTON_RIGHT, 300);
     if (onComplete) {
-        highlightAnim->setOnComplete(onComplete);
+        highlightAnim->setCompleteAction(std::move(onComplete));
     }
     animationEngine.addAnimation(highlightAnim);
 }
@@ -172,10 +172,10 @@ void UINavBar::showLeftBlink(int blinkCount, int onDuration, int offDuration, st
     bLeftHighLight = true;
     
     // 创建闪烁动画并添加到动画引擎
-    NavBarAnimation* blinkAnim = new NavBarAnimation(this, NAV_BUTTON_LEFT, (onDuration + offDuration) * blinkCount);
+    NavBarAnimation* blinkAnim = NavBarAnimationPool::acquire(this, NAV_BUTTON_LEFT, (onDuration + offDuration) * blinkCount);
     blinkAnim->setBlinkMode(blinkCount, onDuration, offDuration);
     if (onComplete) {
-        blinkAnim->setOnComplete(onComplete);
+        blinkAnim->setCompleteAction(std::move(onComplete));
     }
     animationEngine.addAnimation(blinkAnim);
 }
@@ -185,10 +185,10 @@ void UINavBar::showMiddleBlink(int blinkCount, int onDuration, int offDuration,
     bMiddleHighLight = true;
     
     // 创建闪烁动画并添加到动画引擎
-    NavBarAnimation* blinkAnim = new NavBarAnimation(this, NAV_BUTTON_MIDDLE, (onDuration + offDuration) * blinkCount);
+    NavBarAnimation* blinkAnim = NavBarAnimationPool::acquire(this, NAV_BUTTON_MIDDLE, (onDuration + offDuration) * blinkCount);
     blinkAnim->setBlinkMode(blinkCount, onDuration, offDuration);
     if (onComplete) {
-        blinkAnim->setOnComplete(onComplete);
+        blinkAnim->setCompleteAction(std::move(onComplete));
     }
     animationEngine.addAnimation(blinkAnim);
 }
@@ -198,10 +198,10 @@ void UINavBar::showRightBlink(int blinkCount, int onDuration, int offDuration, s
     bRightHighLight = true;
     
     // 创建闪烁动画并添加到动画引擎
-    NavBarAnimation* blinkAnim = new NavBarAnimation(this, NAV_BUTTON_RIGHT, (onDuration + offDuration) * blinkCount);
+    NavBarAnimation* blinkAnim = NavBarAnimationPool::acquire(this, NAV_BUTTON_RIGHT, (onDuration + offDuration) * blinkCount);
     blinkAnim->setBlinkMode(blinkCount, onDuration, offDuration);
     if (onComplete) {
-        blinkAnim->setOnComplete(onComplete);
+        blinkAnim->setCompleteAction(std::move(onComplete));
     }
     animationEngine.addAnimation(blinkAnim);
 }
\ No newline at end of file
@@ -54,7 +54,7 @@ void UIQuickButton::showHighLight()
   bHighLight = true;
   
   // 创建高亮动画并添加到动画引擎
-  QuickButtonAnimation* highlightAnim = new QuickButtonAnimation(this, 300);
+  QuickButtonAnimation* highlightAnim = QuickButtonAnimationPool::acquire(this, 300);
   animationEngine.addAnimation(highlightAnim);
 }
 
@@ -64,7 +64,7 @@ void UIQuickButton::showBlink(int blinkCount, int onDuration, int offDuration)
   bHighLight = true;
   
   // 创建闪烁动画并添加到动画引擎
-  QuickButtonAnimation* blinkAnim = new QuickButtonAnimation(this, (onDuration + offDuration) * blinkCount);
+  QuickButtonAnimation* blinkAnim = QuickButtonAnimationPool::acquire(this, (onDuration + offDuration) * blinkCount);
   blinkAnim->setBlinkMode(blinkCount, onDuration, offDuration);
   animationEngine.addAnimation(blinkAnim);
 }
\ No newline at end of file
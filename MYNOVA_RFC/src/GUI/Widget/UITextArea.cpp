@@ -5,6 +5,10 @@
 */
 
 #include "UITextArea.h"
+#include "../GlyphWidthCache.h"
+
+// 单行最大字节数（128像素宽的屏幕上一行放不下更多字符）
+#define TEXTAREA_LINE_MAX_BYTES 160
 
 UITextArea::UITextArea() {
     scrollIndex = 0;
@@ -12,6 +16,9 @@ UITextArea::UITextArea() {
     lineHeight = 14;  // 增加默认行高，避免拥挤
     textFont = u8g2_font_wqy12_t_gb2312;
     needRecalculate = false;
+    cachedWidth = 0;
+    cachedFont = nullptr;
+    cachedLength = 0;
     bVisible = true;
 }
 
@@ -43,13 +50,13 @@ void UITextArea::scrollDown() {
     }
 }
 
-// 辅助函数：判断是否是UTF-8多字节字符的后续字节
-bool isUtf8Continuation(char c) {
-    return (c & 0xC0) == 0x80;
-}
-
+// 按字形宽度缓存逐字符累加行宽，整段文本只扫描一遍
 void UITextArea::splitText(U8G2* u8g2) {
     lines.clear();
+    cachedWidth = width;
+    cachedFont = textFont;
+    cachedLength = text.length();
+    needRecalculate = false;
     
     if (text.length() == 0) return;
     
@@ -59,62 +66,49 @@ void UITextArea::splitText(U8G2* u8g2) {
     int contentWidth = width - 12; 
     if (contentWidth <= 0) contentWidth = 10; // 防止无效宽度
 
-    String currentLine = "";
-    int len = text.length();
+    const char* str = text.c_str();
+    const int len = text.length();
+    int lineStart = 0;
+    int lineWidth = 0;
     int i = 0;
 
     while (i < len) {
-        // 提取下一个字符（处理UTF-8）
-        String charStr = "";
-        char c = text[i];
-        uint8_t uc = (uint8_t)c;
-        charStr += c;
-        i++;
-
-        // 如果是多字节字符的首字节
-        int charLen = 1;
-        if ((uc & 0xE0) == 0xC0) charLen = 2;
-        else if ((uc & 0xF0) == 0xE0) charLen = 3;
-        else if ((uc & 0xF8) == 0xF0) charLen = 4;
-        
-        // 读取剩余字节
-        for (int k = 1; k < charLen && i < len; k++) {
-            charStr += text[i++];
-        }
-
         // 处理换行符
-        if (c == '\n') {
-            lines.push_back(currentLine);
-            currentLine = "";
+        if (str[i] == '\n') {
+            lines.push_back({(uint16_t)lineStart, (uint16_t)(i - lineStart)});
+            i++;
+            lineStart = i;
+            lineWidth = 0;
             continue;
         }
 
-        // 尝试添加到当前行
-        String testLine = currentLine + charStr;
-        // 使用 getUTF8Width 替代 getStrWidth 以支持 UTF-8 字符宽度计算
-        if (u8g2->getUTF8Width(testLine.c_str()) > contentWidth) {
-            // 超出宽度，当前行结束
-            // 只有当当前行不为空时才换行，避免死循环（理论上单个字符不会超过contentWidth，除非太窄）
-            if (currentLine.length() > 0) {
-                lines.push_back(currentLine);
-                currentLine = charStr;
+        // 提取下一个字符（处理UTF-8）
+        uint16_t encoding;
+        const int charLen = GlyphWidthCache::decodeUtf8(str, len, i, &encoding);
+        const int charWidth = glyphWidthCache.getWidth(u8g2, textFont, encoding);
+
+        // 超出宽度（或超过行缓冲区）时当前行结束
+        if (lineWidth + charWidth > contentWidth || i + charLen - lineStart > TEXTAREA_LINE_MAX_BYTES) {
+            if (i > lineStart) {
+                lines.push_back({(uint16_t)lineStart, (uint16_t)(i - lineStart)});
+                lineStart = i;
+                lineWidth = charWidth;
             } else {
-                // 如果当前行是空的，但加这一个字符就超出了（说明这字符超级宽，或者contentWidth太小）
-                // 强制放入一行
-                lines.push_back(charStr);
-                currentLine = "";
+                // 单个字符就超出了（说明这字符超级宽，或者contentWidth太小），强制放入一行
+                lines.push_back({(uint16_t)i, (uint16_t)charLen});
+                lineStart = i + charLen;
+                lineWidth = 0;
             }
         } else {
-            currentLine = testLine;
+            lineWidth += charWidth;
         }
+        i += charLen;
     }
     
     // 添加最后一行
-    if (currentLine.length() > 0) {
-        lines.push_back(currentLine);
+    if (lineStart < len) {
+        lines.push_back({(uint16_t)lineStart, (uint16_t)(len - lineStart)});
     }
-    
-    needRecalculate = false;
 }
 
 void UITextArea::render(U8G2* u8g2, int offsetX, int offsetY) {
@@ -129,12 +123,8 @@ void UITextArea::render(U8G2* u8g2, int offsetX, int offsetY) {
     if (availableHeight < lineHeight) availableHeight = lineHeight;
     visibleLines = availableHeight / lineHeight;
 
-    // 如果需要重新计算行（比如首次渲染或文本改变）
-    // 或者宽度改变了（虽然这里没法直接检测宽度改变，但splitText依赖宽度）
-    // 为了安全，每次render前确保splitText使用最新的宽度逻辑
-    // 但splitText比较耗时，还是依赖 needRecalculate
-    // 假设 width 不会频繁变
-    if (needRecalculate) {
+    // 文本、字体或宽度变化时才重新换行
+    if (needRecalculate || width != cachedWidth || textFont != cachedFont || text.length() != cachedLength) {
         splitText(u8g2);
     }
     
@@ -166,7 +156,10 @@ void UITextArea::render(U8G2* u8g2, int offsetX, int offsetY) {
     for (int i = scrollIndex; i < (int)lines.size(); i++) {
         if (count >= visibleLines) break;
         
-        u8g2->drawUTF8(contentX, contentY + count * lineHeight, lines[i].c_str());
+        char lineBuffer[TEXTAREA_LINE_MAX_BYTES + 1];
+        memcpy(lineBuffer, text.c_str() + lines[i].start, lines[i].length);
+        lineBuffer[lines[i].length] = '\0';
+        u8g2->drawUTF8(contentX, contentY + count * lineHeight, lineBuffer);
         count++;
     }
     
@@ -28,9 +28,17 @@ public:
   const uint8_t* textFont;
   
 private:
-  std::vector<String> lines;
+  // 一行在 text 中的字节范围，换行结果只在文本、字体或宽度变化时重新计算
+  struct LineSpan {
+    uint16_t start;
+    uint16_t length;
+  };
+  std::vector<LineSpan> lines;
   void splitText(U8G2* u8g2); // 将文本分割成多行
   bool needRecalculate;
+  int cachedWidth;             // 上次换行时使用的宽度
+  const uint8_t* cachedFont;   // 上次换行时使用的字体
+  unsigned int cachedLength;   // 上次换行时的文本长度（text 被直接赋值时也能发现变化）
 };
 
 #endif
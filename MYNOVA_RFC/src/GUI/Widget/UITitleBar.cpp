@@ -46,23 +46,21 @@ void UITitleBar::render(U8G2* u8g2,int offsetX, int offsetY) {
         u8g2->drawGlyph(drawX, drawY + 10, 57948);//5格信号
         break;
     }
-    if(sendAnime)
+    if(sendAnime || reciveAnime)
     {
-        animeCount--;
-        signalStrength++;
-        if(signalStrength > 4)
-            signalStrength = 0;
-        if(animeCount <= 0)
+        int step = (millis() - animeStartTime) / TITLEBAR_ANIME_STEP_MS;
+        if(step > TITLEBAR_ANIME_STEPS)
+            step = TITLEBAR_ANIME_STEPS;
+        //下一帧显示的信号格数：发送逐格增加，接收逐格减少
+        if(sendAnime)
+            signalStrength = step % 5;
+        else
+            signalStrength = 4 - step % 5;
+        if(step >= TITLEBAR_ANIME_STEPS)
+        {
             sendAnime = false;
-    }
-    if(reciveAnime)
-    {
-        animeCount--;
-        signalStrength--;
-        if(signalStrength < 0)
-            signalStrength = 4;
-        if(animeCount <= 0)
             reciveAnime = false;
+        }
     }
     drawX += 10;
     if(signalMode == 0)
@@ -132,16 +130,23 @@ void UITitleBar::render(U8G2* u8g2,int offsetX, int offsetY) {
 
 void UITitleBar::showSendAnime()
 {
-    animeCount = 25;
+    animeStartTime = millis();
     signalStrength = 0;
     sendAnime = true;
+    reciveAnime = false;
 }
 
 void UITitleBar::showReciveAnime()
 {
-    animeCount = 25;
+    animeStartTime = millis();
     signalStrength = 4;
     reciveAnime = true;
+    sendAnime = false;
+}
+
+bool UITitleBar::isAnimating()
+{
+    return sendAnime || reciveAnime;
 }
 
 void UITitleBar::setBuzzerState(int state)
@@ -11,12 +11,17 @@
 #include <Arduino.h>
 #include <U8g2lib.h>
 
+// 收发动画按时间推进：信号格数每步变化一格，共25步，与刷新间隔无关
+#define TITLEBAR_ANIME_STEPS   25
+#define TITLEBAR_ANIME_STEP_MS 20
+
 class UITitleBar : public UIWidget {
 public:
   UITitleBar();
   void render(U8G2* u8g2,int offsetX = 0, int offsetY = 0) override;
   void showSendAnime();
   void showReciveAnime();
+  bool isAnimating();
   void setBuzzerState(int state);
   void showAP(bool bShow);
   void showWifi(bool bShow);
@@ -28,7 +33,7 @@ public:
 
 private:
   String label;
-  int animeCount;
+  unsigned long animeStartTime;
   bool sendAnime = false;
   bool reciveAnime = false;
   bool bShowAP = false;
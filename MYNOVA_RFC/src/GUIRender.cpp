@@ -9,6 +9,8 @@
 #include <U8g2lib.h>
 #include "GUI/UIEngine.h"
 #include "GUI/UIPage.h"
+#include "GUI/FrameProfiler.h"
+#include "ButtonHandle.h"
 #include "GUI/Widget/UITitleBar.h"
 #include "GUI/Widget/UIQuickButton.h"
 #include "GUI/Widget/UIMenu.h"
@@ -21,9 +23,29 @@ U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE, /* clock=*/PIN_
 UIEngine uiEngine;
 HomePage uiPageHome;
 
+extern ButtonHandle buttonHandle;
+
+// 上一次发送到屏幕的帧，用于找出变化的分块
+static uint8_t lastFrame[SCREEN_WIDTH * SCREEN_TILE_HEIGHT];
+static bool lastFrameValid = false;
+static DisplayStats displayStats = {0};
+// 双缓冲：u8g2 在后台缓冲区中绘制下一帧，传输任务同时发送前台缓冲区中的上一帧
+static uint8_t spareBuffer[SCREEN_WIDTH * SCREEN_TILE_HEIGHT];
+static uint8_t* frontBuffer = nullptr;
+static SemaphoreHandle_t transferDone = nullptr;  // 前台缓冲区已发送完，可以交换
+static SemaphoreHandle_t displayMutex = nullptr;  // 保护I2C总线，其他任务发送屏幕命令时使用
+// 屏幕处于省电模式时渲染任务停止绘制
+static volatile bool displaySleeping = false;
+// 按键到屏幕显示的延迟：本帧分发的按键时间戳随帧交给传输任务，发送完成后记录
+static uint32_t pendingInputTimestamps[BUTTON_EVENT_QUEUE_SIZE];
+static int pendingInputCount = 0;
+static uint32_t frontInputTimestamps[BUTTON_EVENT_QUEUE_SIZE];
+static int frontInputCount = 0;
+
 GUIRender::GUIRender()
 {
     drawGUITaskHandle = nullptr;
+    displayTransferTaskHandle = nullptr;
 }
 
 // 仅初始化显示屏（用于SplashScreen阶段）
@@ -31,6 +53,7 @@ void GUIRender::initDisplay()
 {
     Serial.println("GUIRender: 初始化显示屏");
     u8g2.begin();
+    lastFrameValid = false;
 }
 
 // 获取U8G2指针
@@ -48,6 +71,8 @@ void GUIRender::init()
         u8g2.begin();
     }
     
+    // 启动画面直接写过屏幕，第一帧整屏发送
+    lastFrameValid = false;
     uiEngine.setCurrentPage(&uiPageHome);
     startRenderTask();
 }
@@ -60,50 +85,273 @@ void GUIRender::startRenderTask()
         return;
     }
     
+    if (transferDone == nullptr) {
+        transferDone = xSemaphoreCreateBinary();
+        xSemaphoreGive(transferDone);
+    }
+    if (displayMutex == nullptr) {
+        displayMutex = xSemaphoreCreateMutex();
+    }
+    // 启动画面使用的是u8g2自带的缓冲区，它作为第一个前台缓冲区
+    frontBuffer = spareBuffer;
+
+    xTaskCreate(
+        displayTransferTask,        // 任务函数
+        "DisplayTransfer",          // 任务名称
+        4096,                       // 任务堆栈大小（4KB）
+        this,                       // 任务参数
+        3,                          // 任务优先级
+        &displayTransferTaskHandle  // 任务句柄
+    );
+
     xTaskCreate(
         drawGUITask,                // 任务函数
         "DrawGUITask",              // 任务名称
-        8192,                       // 任务堆栈大小（8KB）
+        12288,                      // 任务堆栈大小（12KB，按键处理也在此任务中执行）
         this,                       // 任务参数
         3,                          // 任务优先级
         &drawGUITaskHandle          // 任务句柄
     );
+    uiEngine.setRenderTask(drawGUITaskHandle);
 
     Serial.println("GUIRender: 渲染任务已启动");
 }
 
 // 绘制界面
+// 按需渲染：有动画或页面需要连续渲染时按帧间隔绘制；否则等待重绘请求（任务通知），
+// 超过页面的刷新间隔仍没有请求时也绘制一帧，用于页面中的定时逻辑。屏幕关闭期间完全停止。
+// 按键事件也在这里两帧之间分发，页面只在渲染任务中被访问。
 void GUIRender::drawGUITask(void* pvParameters)
 {
+    GUIRender* self = (GUIRender*)pvParameters;
     while (true)
     {
+        // 分发按键事件（按键可能唤醒屏幕，所以在检查省电状态之前）
+        pendingInputCount += buttonHandle.processEvents(pendingInputTimestamps + pendingInputCount,
+                                                        BUTTON_EVENT_QUEUE_SIZE - pendingInputCount);
+
+        if (displaySleeping) {
+            // 等待 setPowerSave(false) 唤醒
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        const uint32_t frameStart = micros();
+        uiEngine.update();
+
+        const uint32_t renderStart = micros();
         u8g2.clearBuffer(); // 清除内部缓冲区
     
         uiEngine.render(&u8g2);
 
-        u8g2.sendBuffer(); // transfer internal memory to the display
+        const uint32_t renderMicros = micros() - renderStart;
+        displayStats.totalRenderMicros += renderMicros;
+        if (renderMicros > displayStats.maxRenderMicros) {
+            displayStats.maxRenderMicros = renderMicros;
+        }
 
-        uiEngine.update();
+        // 叠加层在统计之后绘制，不计入页面的渲染耗时
+        if (frameProfiler.isOverlayEnabled()) {
+            frameProfiler.drawOverlay(&u8g2);
+        }
+
+        self->presentFrame();
+        frameProfiler.recordFrame(micros() - frameStart);
+
+        const uint32_t refreshInterval = uiEngine.getRefreshInterval();
+        // 过渡结束时队列中还有暂缓的按键，不进入空闲等待，下一轮立即分发
+        if (refreshInterval == 0 || buttonHandle.hasPendingEvents()) {
+            delay(GUI_FRAME_INTERVAL_MS);
+        } else if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(refreshInterval)) > 0) {
+            displayStats.idleWakeups++;
+        }
+    }
+}
+
+
+// 交换前后台缓冲区并通知传输任务发送刚绘制完的一帧
+void GUIRender::presentFrame()
+{
+    // 上一帧还没发送完时等待，前台缓冲区不能被覆盖
+    if (xSemaphoreTake(transferDone, 0) != pdTRUE) {
+        displayStats.transferWaits++;
+        xSemaphoreTake(transferDone, portMAX_DELAY);
+    }
+    u8g2_t* u8g2Struct = u8g2.getU8g2();
+    uint8_t* drawnBuffer = u8g2Struct->tile_buf_ptr;
+    u8g2Struct->tile_buf_ptr = frontBuffer;
+    frontBuffer = drawnBuffer;
+    // 传输任务空闲时才会走到这里，可以直接交出本帧的按键时间戳
+    memcpy(frontInputTimestamps, pendingInputTimestamps, pendingInputCount * sizeof(uint32_t));
+    frontInputCount = pendingInputCount;
+    pendingInputCount = 0;
+    xTaskNotifyGive(displayTransferTaskHandle);
+}
+
+// 屏幕传输任务：I2C发送期间渲染任务可以继续绘制下一帧
+void GUIRender::displayTransferTask(void* pvParameters)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        const uint32_t transferStart = micros();
+        xSemaphoreTake(displayMutex, portMAX_DELAY);
+        flushDisplay(frontBuffer);
+        xSemaphoreGive(displayMutex);
+
+        const uint32_t transferMicros = micros() - transferStart;
+        displayStats.totalTransferMicros += transferMicros;
+        if (transferMicros > displayStats.maxTransferMicros) {
+            displayStats.maxTransferMicros = transferMicros;
+        }
+        frameProfiler.recordTransfer(transferMicros);
+
+        // 这一帧已显示在屏幕上，记录其中每个按键事件的端到端延迟
+        const uint32_t displayedAt = micros();
+        for (int i = 0; i < frontInputCount; i++) {
+            frameProfiler.recordInputLatency(displayedAt - frontInputTimestamps[i]);
+        }
+        frontInputCount = 0;
+        xSemaphoreGive(transferDone);
+    }
+}
+
+// 从指定缓冲区发送一段分块（SSD1306缓冲区每个分块行128字节，每个分块8字节）
+static void sendTiles(const uint8_t* buffer, int tileX, int tileY, int tileCount)
+{
+    u8x8_DrawTile(u8g2.getU8x8(), tileX, tileY, tileCount,
+                  (uint8_t*)buffer + tileY * SCREEN_WIDTH + tileX * 8);
+}
 
-        // 减少延迟以提高界面响应速度
-        delay(10);
+static void sendFullFrame(const uint8_t* buffer)
+{
+    for (int row = 0; row < SCREEN_TILE_HEIGHT; row++) {
+        sendTiles(buffer, 0, row, SCREEN_TILE_WIDTH);
+    }
+    u8x8_RefreshDisplay(u8g2.getU8x8());
+}
+
+// 以分块行为单位对比缓冲区：每行只发送第一个到最后一个变化分块之间的区域
+void GUIRender::flushDisplay(const uint8_t* buffer)
+{
+    displayStats.frames++;
+
+    if (!lastFrameValid) {
+        sendFullFrame(buffer);
+        memcpy(lastFrame, buffer, sizeof(lastFrame));
+        lastFrameValid = true;
+        displayStats.fullFrames++;
+        displayStats.tilesSent += SCREEN_TILE_WIDTH * SCREEN_TILE_HEIGHT;
+        return;
+    }
+
+    int8_t firstTile[SCREEN_TILE_HEIGHT];
+    int8_t lastTile[SCREEN_TILE_HEIGHT];
+    int changedRows = 0;
+    for (int row = 0; row < SCREEN_TILE_HEIGHT; row++) {
+        const uint8_t* current = buffer + row * SCREEN_WIDTH;
+        const uint8_t* previous = lastFrame + row * SCREEN_WIDTH;
+        firstTile[row] = -1;
+        lastTile[row] = -1;
+        if (memcmp(current, previous, SCREEN_WIDTH) == 0) {
+            continue;
+        }
+        for (int tile = 0; tile < SCREEN_TILE_WIDTH; tile++) {
+            if (memcmp(current + tile * 8, previous + tile * 8, 8) != 0) {
+                if (firstTile[row] < 0) {
+                    firstTile[row] = tile;
+                }
+                lastTile[row] = tile;
+            }
+        }
+        changedRows++;
+    }
+
+    if (changedRows == 0) {
+        displayStats.skippedFrames++;
+        return;
+    }
+
+    if (changedRows > PARTIAL_UPDATE_MAX_ROWS) {
+        sendFullFrame(buffer);
+        memcpy(lastFrame, buffer, sizeof(lastFrame));
+        displayStats.fullFrames++;
+        displayStats.tilesSent += SCREEN_TILE_WIDTH * SCREEN_TILE_HEIGHT;
+        return;
+    }
+
+    for (int row = 0; row < SCREEN_TILE_HEIGHT; row++) {
+        if (firstTile[row] < 0) {
+            continue;
+        }
+        const int tileCount = lastTile[row] - firstTile[row] + 1;
+        sendTiles(buffer, firstTile[row], row, tileCount);
+        memcpy(lastFrame + row * SCREEN_WIDTH + firstTile[row] * 8,
+               buffer + row * SCREEN_WIDTH + firstTile[row] * 8, tileCount * 8);
+        displayStats.tilesSent += tileCount;
+    }
+    u8x8_RefreshDisplay(u8g2.getU8x8());
+    displayStats.partialFrames++;
+}
+
+// 传输任务启动前（启动画面阶段）还没有互斥锁，此时只有一个任务访问屏幕
+static void lockDisplay()
+{
+    if (displayMutex != nullptr) {
+        xSemaphoreTake(displayMutex, portMAX_DELAY);
     }
 }
 
+static void unlockDisplay()
+{
+    if (displayMutex != nullptr) {
+        xSemaphoreGive(displayMutex);
+    }
+}
+
+void GUIRender::invalidateDisplay()
+{
+    lastFrameValid = false;
+}
+
+bool GUIRender::copyFrame(uint8_t* buffer)
+{
+    lockDisplay();
+    memcpy(buffer, lastFrame, sizeof(lastFrame));
+    const bool valid = lastFrameValid;
+    unlockDisplay();
+    return valid;
+}
+
+DisplayStats GUIRender::getDisplayStats()
+{
+    return displayStats;
+}
 
 void GUIRender::setBattery(float voltage)
 {
     uiPageHome.setBattery(voltage);
+    uiEngine.requestRedraw();
 }
 
 void GUIRender::setPowerSave(bool bPowerSave)
 {
+    // 省电模式下屏幕保留显存内容，lastFrame 仍与屏幕一致，唤醒后继续按分块更新
+    displaySleeping = bPowerSave;
+    lockDisplay();
     u8g2.setPowerSave(bPowerSave);
+    unlockDisplay();
+    if (!bPowerSave) {
+        uiEngine.requestRedraw();
+    }
 }
 
 void GUIRender::setContrast(int contrast)
 {
+    lockDisplay();
     u8g2.setContrast(contrast);
+    unlockDisplay();
 }
 
 GUIRender::~GUIRender()
@@ -112,4 +360,8 @@ GUIRender::~GUIRender()
     {
         vTaskDelete(drawGUITaskHandle);
     }
+    if (displayTransferTaskHandle)
+    {
+        vTaskDelete(displayTransferTaskHandle);
+    }
 }
\ No newline at end of file
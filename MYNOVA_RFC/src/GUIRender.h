@@ -15,6 +15,30 @@
 #define SCREEN_WIDTH        128
 #define SCREEN_HEIGHT       64
 
+// 屏幕按8x8像素分块（SSD1306一个页面行 = 8像素高）
+#define SCREEN_TILE_WIDTH   (SCREEN_WIDTH / 8)
+#define SCREEN_TILE_HEIGHT  (SCREEN_HEIGHT / 8)
+// 变化的分块行数超过该值时直接整屏发送，省去多次区域传输的命令开销
+#define PARTIAL_UPDATE_MAX_ROWS 6
+
+// 有动画或连续渲染页面时的帧间隔（毫秒）
+#define GUI_FRAME_INTERVAL_MS   10
+
+// 屏幕刷新统计
+struct DisplayStats {
+    uint32_t frames;        // 渲染的帧数
+    uint32_t skippedFrames; // 与上一帧完全相同、未发送的帧数
+    uint32_t partialFrames; // 只发送变化分块的帧数
+    uint32_t fullFrames;    // 整屏发送的帧数
+    uint32_t tilesSent;     // 发送的分块总数
+    uint32_t idleWakeups;   // 空闲等待中被重绘请求唤醒的次数
+    uint32_t transferWaits; // 绘制完成时上一帧仍在传输、需要等待的次数
+    uint64_t totalRenderMicros;   // 绘制（update之后的clearBuffer+render）总耗时
+    uint64_t totalTransferMicros; // I2C传输总耗时（传输任务中测量）
+    uint32_t maxRenderMicros;
+    uint32_t maxTransferMicros;
+};
+
 class GUIRender
 {
 public:
@@ -27,9 +51,17 @@ public:
     void setBattery(float voltage);
     void setPowerSave(bool bPowerSave);
     void setContrast(int contrast);
+    void invalidateDisplay();  // 下一帧整屏发送（屏幕内容被外部改动后调用）
+    DisplayStats getDisplayStats();
+    // 复制屏幕上当前显示的一帧（SSD1306分块布局，1024字节），还没有发送过任何帧时返回false
+    bool copyFrame(uint8_t* buffer);
     TaskHandle_t drawGUITaskHandle;
+    TaskHandle_t displayTransferTaskHandle;
 private:
     static void drawGUITask(void* pvParameters);
+    static void displayTransferTask(void* pvParameters);  // 发送前台缓冲区，与绘制并行
+    void presentFrame();  // 交换前后台缓冲区
+    static void flushDisplay(const uint8_t* buffer);  // 对比上一帧，只发送变化的分块
 
 };
 
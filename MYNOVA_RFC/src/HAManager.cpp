@@ -18,6 +18,7 @@ HAManager::HAManager() : mqttClient(wifiClient) {
     lastReconnectAttempt = 0;
     lastDiscoveryPublish = 0;
     lastBatteryPublish = 0;
+    snifferCursor = 0;
     
     // 设置默认设备信息
     deviceName = "MYNOVA RFC";
@@ -321,6 +322,10 @@ void HAManager::disconnect() {
 
 void HAManager::loop() {
     if (!mqttClient.connected()) {
+        // 断线期间收到的帧不补发
+        if (pRadioHelper) {
+            snifferCursor = pRadioHelper->GetFrameSequence();
+        }
         unsigned long now = millis();
         // 每5秒尝试重连一次
         if (now - lastReconnectAttempt > 5000) {
@@ -345,6 +350,8 @@ void HAManager::loop() {
             publishBatteryState();
             lastBatteryPublish = now;
         }
+        
+        publishReceivedFrames();
     }
 }
 
@@ -377,17 +384,20 @@ void HAManager::publishDiscovery() {
     
     int publishedCount = 0;
     
-    // 遍历所有数据位置（1-100）
-    for (int i = 1; i <= 100; i++) {
-        RadioData radioData = pDataStore->ReadData(i);
-        
-        // 只发布有效数据
-        if (radioData.name.length() > 0) {
-            publishButtonDiscovery(i, radioData);
+    // 只遍历已占用的槽位，按批取编号
+    int slots[32];
+    int slotCount = 0;
+    int nextIndex = 1;
+    RadioData radioData;
+    while ((slotCount = pDataStore->GetOccupiedSlots(slots, 32, nextIndex)) > 0) {
+        for (int n = 0; n < slotCount; n++) {
+            pDataStore->ReadData(slots[n], radioData);
+            publishButtonDiscovery(slots[n], radioData);
             publishedCount++;
             mqttClient.loop();
             delay(50);
         }
+        nextIndex = slots[slotCount - 1] + 1;
     }
     
     // 发布电池传感器Discovery配置
@@ -412,7 +422,7 @@ void HAManager::publishButtonDiscovery(int index, const RadioData& data) {
     JsonDocument doc;
     
     // 基本信息
-    doc["name"] = data.name;
+    doc["name"] = data.name.c_str();
     doc["unique_id"] = "mynova_rfc_" + deviceID + "_button_" + String(index);
     doc["command_topic"] = commandTopic;
     
@@ -445,7 +455,7 @@ void HAManager::publishButtonDiscovery(int index, const RadioData& data) {
         Serial.print("  [");
         Serial.print(index);
         Serial.print("] ");
-        Serial.println(data.name);
+        Serial.println(data.name.c_str());
     } else {
         Serial.print("  [");
         Serial.print(index);
@@ -507,7 +517,7 @@ void HAManager::handleCommand(String topic, String payload) {
     String buttonIndexStr = topic.substring(buttonStartPos + 7, buttonEndPos);
     int buttonIndex = buttonIndexStr.toInt();
     
-    if (buttonIndex < 1 || buttonIndex > 100) {
+    if (buttonIndex < 1 || buttonIndex > RADIO_DATA_SLOT_COUNT) {
         Serial.println("无效的按钮索引: " + String(buttonIndex));
         return;
     }
@@ -522,7 +532,7 @@ void HAManager::handleCommand(String topic, String payload) {
                 Serial.print("发送射频信号: [");
                 Serial.print(buttonIndex);
                 Serial.print("] ");
-                Serial.print(radioData.name);
+                Serial.print(radioData.name.c_str());
                 Serial.print(" | 数据: ");
                 Serial.print((unsigned long)radioData.rcData.data);
                 Serial.print(" | 频率: ");
@@ -582,6 +592,41 @@ void HAManager::publishBatteryDiscovery() {
     }
 }
 
+void HAManager::publishReceivedFrames() {
+    if (!pRadioHelper) {
+        return;
+    }
+    
+    String frameTopic = topicPrefix + "/received";
+    RadioFrame frame;
+    RadioData savedData;
+    while (pRadioHelper->ReadFrame(snifferCursor, frame)) {
+        JsonDocument doc;
+        doc["sequence"] = frame.sequence;
+        doc["timestamp"] = frame.timestamp;
+        doc["freqType"] = (int)frame.rcData.freqType;
+        doc["data"] = (unsigned long)frame.rcData.data;
+        doc["bitLength"] = frame.rcData.bitLength;
+        doc["protocol"] = frame.rcData.protocal;
+        doc["pulseLength"] = frame.rcData.pulseLength;
+        doc["repeatCount"] = frame.repeatCount;
+        
+        // 已保存的编码附带槽位与名称
+        if (pDataStore) {
+            int savedIndex = pDataStore->FindSlotByCode(frame.rcData);
+            if (savedIndex > 0) {
+                doc["index"] = savedIndex;
+                pDataStore->ReadData(savedIndex, savedData);
+                doc["name"] = savedData.name.c_str();
+            }
+        }
+        
+        String payload;
+        serializeJson(doc, payload);
+        mqttClient.publish(frameTopic.c_str(), payload.c_str());
+    }
+}
+
 void HAManager::publishBatteryState() {
     if (!mqttClient.connected()) {
         return;
@@ -136,6 +136,7 @@ private:
     unsigned long lastReconnectAttempt;
     unsigned long lastDiscoveryPublish;
     unsigned long lastBatteryPublish;
+    uint32_t snifferCursor;     // 接收帧队列读取游标
     
     /**
      * MQTT回调函数
@@ -162,6 +163,11 @@ private:
      */
     void publishBatteryState();
     
+    /**
+     * 发布接收帧队列中的新帧
+     */
+    void publishReceivedFrames();
+    
     /**
      * 生成唯一设备ID
      */
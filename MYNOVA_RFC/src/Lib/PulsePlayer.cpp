@@ -0,0 +1,166 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "PulsePlayer.h"
+
+// ==================== GpioPulsePlayer ====================
+
+GpioPulsePlayer::GpioPulsePlayer() : pin(-1) {
+}
+
+bool GpioPulsePlayer::begin(int pin) {
+    this->pin = pin;
+    pinMode(pin, OUTPUT);
+    return true;
+}
+
+void GpioPulsePlayer::end() {
+    pin = -1;
+}
+
+bool GpioPulsePlayer::play(const PulseTrain& train, unsigned int repeat) {
+    if (pin == -1) {
+        return false;
+    }
+
+    for (unsigned int r = 0; r < repeat; r++) {
+        for (size_t i = 0; i < train.size(); i++) {
+            digitalWrite(pin, train.levelAt(i));
+            delayMicroseconds(train.durationAt(i));
+        }
+    }
+
+    // Disable transmit after sending (i.e., for inverted protocols)
+    digitalWrite(pin, LOW);
+    return true;
+}
+
+// ==================== RmtPulsePlayer ====================
+
+#if defined(ESP32)
+
+RmtPulsePlayer::RmtPulsePlayer() : pin(-1) {
+}
+
+bool RmtPulsePlayer::begin(int pin) {
+    if (this->pin == pin) {
+        return true;
+    }
+    if (this->pin != -1) {
+        end();
+    }
+    // 1MHz分辨率：1 tick = 1us，与脉冲序列单位一致；
+    // 预留两个内存块，保证一整帧可放入RMT内存用于硬件循环
+    if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_2, 1000000)) {
+        Serial.println("RmtPulsePlayer: rmtInit失败");
+        return false;
+    }
+    // 发送结束后保持低电平
+    rmtSetEOT(pin, LOW);
+    this->pin = pin;
+    return true;
+}
+
+void RmtPulsePlayer::end() {
+    if (pin == -1) {
+        return;
+    }
+    wait();
+    rmtDeinit(pin);
+    pin = -1;
+}
+
+bool RmtPulsePlayer::play(const PulseTrain& train, unsigned int repeat) {
+    if (pin == -1 || train.size() == 0 || repeat == 0) {
+        return false;
+    }
+
+    // RMT仍在读取symbols，先等待上一次发送结束
+    wait();
+
+    // 两个电平段合成一个RMT符号；奇数段时用1us同电平补齐，
+    // 不能用0时长，否则会被当作结束标记
+    size_t numSymbols = 0;
+    for (size_t i = 0; i < train.size() && numSymbols < RMT_PULSE_MAX_SYMBOLS; i += 2) {
+        rmt_data_t& symbol = symbols[numSymbols++];
+        symbol.level0 = train.levelAt(i);
+        symbol.duration0 = train.durationAt(i);
+        if (i + 1 < train.size()) {
+            symbol.level1 = train.levelAt(i + 1);
+            symbol.duration1 = train.durationAt(i + 1);
+        } else {
+            symbol.level1 = train.levelAt(i);
+            symbol.duration1 = 1;
+        }
+    }
+
+#if ESP_ARDUINO_VERSION >= ESP_ARDUINO_VERSION_VAL(3, 1, 0)
+    // 重复次数交给RMT硬件循环，整段发送期间CPU空闲
+    return rmtWriteRepeated(pin, symbols, numSymbols, repeat);
+#else
+    // 旧版本核心没有硬件循环：逐帧发送，等待期间任务阻塞而不是忙等
+    for (unsigned int r = 0; r + 1 < repeat; r++) {
+        if (!rmtWrite(pin, symbols, numSymbols, RMT_WAIT_FOR_EVER)) {
+            return false;
+        }
+    }
+    return rmtWriteAsync(pin, symbols, numSymbols);
+#endif
+}
+
+bool RmtPulsePlayer::busy() {
+    return pin != -1 && !rmtTransmitCompleted(pin);
+}
+
+void RmtPulsePlayer::wait() {
+    while (busy()) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+}
+
+#endif
+
+// ==================== PulseRecorder ====================
+
+PulseRecorder::PulseRecorder(Edge* buffer, size_t capacity)
+    : edges(buffer), capacity(capacity), count(0), overflow(false) {
+}
+
+bool PulseRecorder::begin(int pin) {
+    return true;
+}
+
+void PulseRecorder::end() {
+}
+
+void PulseRecorder::clear() {
+    count = 0;
+    overflow = false;
+}
+
+void PulseRecorder::record(uint8_t level, uint32_t time) {
+    if (count >= capacity) {
+        overflow = true;
+        return;
+    }
+    edges[count].level = level;
+    edges[count].time = time;
+    count++;
+}
+
+bool PulseRecorder::play(const PulseTrain& train, unsigned int repeat) {
+    const uint32_t start = micros();
+
+    // 与GpioPulsePlayer相同的时序，只是把digitalWrite换成记录
+    for (unsigned int r = 0; r < repeat; r++) {
+        for (size_t i = 0; i < train.size(); i++) {
+            record(train.levelAt(i), micros() - start);
+            delayMicroseconds(train.durationAt(i));
+        }
+    }
+    record(LOW, micros() - start);
+    return true;
+}
@@ -0,0 +1,104 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef _PULSE_PLAYER_H_
+#define _PULSE_PLAYER_H_
+
+#include <Arduino.h>
+#include "PulseTrain.h"
+
+/**
+ * @brief 脉冲序列播放后端接口
+ *
+ * play() 可以在发送结束前返回（硬件后端），调用者通过 busy()/wait()
+ * 判断发送是否完成。同一时刻只播放一个序列，新的 play() 会先等待上一次完成。
+ */
+class PulsePlayer {
+public:
+    virtual ~PulsePlayer() {}
+
+    // 占用输出引脚，失败返回false
+    virtual bool begin(int pin) = 0;
+    // 释放输出引脚（会等待正在进行的发送结束）
+    virtual void end() = 0;
+    // 发送 repeat 次完整序列，结束后输出低电平
+    virtual bool play(const PulseTrain& train, unsigned int repeat) = 0;
+    // 是否仍在发送
+    virtual bool busy() { return false; }
+    // 阻塞等待发送结束
+    virtual void wait() {}
+};
+
+/**
+ * @brief GPIO软件播放：digitalWrite + delayMicroseconds，阻塞直到发送完成
+ */
+class GpioPulsePlayer : public PulsePlayer {
+public:
+    GpioPulsePlayer();
+    bool begin(int pin) override;
+    void end() override;
+    bool play(const PulseTrain& train, unsigned int repeat) override;
+
+private:
+    int pin;
+};
+
+#if defined(ESP32)
+// RMT单帧最多的符号数（每个符号包含两个电平段）
+#define RMT_PULSE_MAX_SYMBOLS (PULSE_TRAIN_MAX_RUNS / 2 + 1)
+
+/**
+ * @brief RMT硬件播放：整段发送（含重复）由RMT外设完成，play() 立即返回，
+ * 发送期间不占用CPU
+ */
+class RmtPulsePlayer : public PulsePlayer {
+public:
+    RmtPulsePlayer();
+    bool begin(int pin) override;
+    void end() override;
+    bool play(const PulseTrain& train, unsigned int repeat) override;
+    bool busy() override;
+    void wait() override;
+
+private:
+    int pin;
+    // 发送期间RMT直接读取此缓冲区，下一次play()前需等待发送结束
+    rmt_data_t symbols[RMT_PULSE_MAX_SYMBOLS];
+};
+#endif
+
+/**
+ * @brief 录制播放：不驱动引脚，按与GPIO播放相同的时序记录每个电平变化的时间戳，
+ * 用于在主机上检查实际输出波形的时序精度和抖动
+ */
+class PulseRecorder : public PulsePlayer {
+public:
+    struct Edge {
+        uint8_t level;      // 变化后的电平
+        uint32_t time;      // 相对于播放开始的时间（微秒）
+    };
+
+    // buffer 由调用者提供，录制满后丢弃后续边沿
+    PulseRecorder(Edge* buffer, size_t capacity);
+    bool begin(int pin) override;
+    void end() override;
+    bool play(const PulseTrain& train, unsigned int repeat) override;
+
+    void clear();
+    size_t size() const { return count; }
+    const Edge& edgeAt(size_t index) const { return edges[index]; }
+    bool overflowed() const { return overflow; }
+
+private:
+    void record(uint8_t level, uint32_t time);
+
+    Edge* edges;
+    size_t capacity;
+    size_t count;
+    bool overflow;
+};
+
+#endif // _PULSE_PLAYER_H_
@@ -0,0 +1,46 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "PulseTrain.h"
+
+PulseTrain::PulseTrain() : count(0) {
+}
+
+void PulseTrain::clear() {
+    count = 0;
+}
+
+bool PulseTrain::append(uint8_t level, uint32_t duration) {
+    const uint16_t levelBit = level ? 0x8000 : 0;
+
+    while (duration > 0) {
+        // 与上一段电平相同且未满时直接延长
+        if (count > 0 && (runs[count - 1] & 0x8000) == levelBit &&
+            durationAt(count - 1) < PULSE_TRAIN_MAX_DURATION) {
+            uint32_t room = PULSE_TRAIN_MAX_DURATION - durationAt(count - 1);
+            uint32_t chunk = (duration < room) ? duration : room;
+            runs[count - 1] += chunk;
+            duration -= chunk;
+            continue;
+        }
+
+        if (count >= PULSE_TRAIN_MAX_RUNS) {
+            return false;
+        }
+        uint32_t chunk = (duration < PULSE_TRAIN_MAX_DURATION) ? duration : PULSE_TRAIN_MAX_DURATION;
+        runs[count++] = levelBit | (uint16_t)chunk;
+        duration -= chunk;
+    }
+    return true;
+}
+
+uint32_t PulseTrain::totalDuration() const {
+    uint32_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += durationAt(i);
+    }
+    return total;
+}
@@ -0,0 +1,47 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef _PULSE_TRAIN_H_
+#define _PULSE_TRAIN_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 单帧最多的电平段数：32位 × 2 + 同步 2，另留出超长电平拆分的余量
+#define PULSE_TRAIN_MAX_RUNS 96
+
+// 单个电平段可表示的最长时间（微秒），更长的电平会拆成多段
+#define PULSE_TRAIN_MAX_DURATION 0x7FFF
+
+/**
+ * @brief 预编译的射频脉冲序列（游程编码）
+ *
+ * 每个电平段占 16 位：最高位为电平，低 15 位为持续时间（微秒）。
+ * 一帧编码只需渲染一次，重复发送由播放后端负责。
+ */
+class PulseTrain {
+public:
+    PulseTrain();
+
+    // 清空序列
+    void clear();
+
+    // 追加一个电平段，与上一段电平相同时自动合并；超出容量返回false
+    bool append(uint8_t level, uint32_t duration);
+
+    size_t size() const { return count; }
+    uint8_t levelAt(size_t index) const { return (runs[index] >> 15) & 0x01; }
+    uint16_t durationAt(size_t index) const { return runs[index] & PULSE_TRAIN_MAX_DURATION; }
+
+    // 一帧的总时长（微秒）
+    uint32_t totalDuration() const;
+
+private:
+    uint16_t runs[PULSE_TRAIN_MAX_RUNS];
+    size_t count;
+};
+
+#endif // _PULSE_TRAIN_H_
@@ -1,5 +1,5 @@
 /*
-  RCSwitchB - Arduino libary for remote control outlet switches
+  RCSwitch - Arduino libary for remote control outlet switches
   Copyright (c) 2011 Suat Özgür.  All right reserved.
   
   Contributors:
@@ -32,7 +32,7 @@
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
-#include "RCSwitchB.h"
+#include "RCSwitch.h"
 
 #ifdef RaspberryPi
     // PROGMEM and _P functions are for AVR based microprocessors,
@@ -75,7 +75,7 @@
  * These are combined to form Tri-State bits when sending or receiving codes.
  */
 // 注意：不能使用 const，否则会放在 Flash 中，ISR 无法访问
-static VAR_ISR_ATTR RCSwitchB::Protocol proto[] = {
+static VAR_ISR_ATTR RCSwitch::Protocol proto[] = {
   // { 350, {  1, 31 }, {  1,  3 }, {  3,  1 }, false },    // protocol 1
   // { 650, {  1, 10 }, {  1,  2 }, {  2,  1 }, false },    // protocol 2
   // { 100, { 30, 71 }, {  4, 11 }, {  9,  6 }, false },    // protocol 3
@@ -88,6 +88,7 @@ static VAR_ISR_ATTR RCSwitchB::Protocol proto[] = {
   // { 365, { 18,  1 }, {  3,  1 }, {  1,  3 }, true },     // protocol 10 (1ByOne Doorbell)
   // { 270, { 36,  1 }, {  1,  2 }, {  2,  1 }, true },     // protocol 11 (HT12E)
   // { 320, { 36,  1 }, {  1,  2 }, {  2,  1 }, true }      // protocol 12 (SM5212)
+
   // --- 1..12 (原始常见协议，保留/扩展) ---
   { 350, {  1, 31 }, {  1,  3 }, {  3,  1 }, false }, // 1 PT2262 标准 (433/315)
   { 650, {  1, 10 }, {  1,  2 }, {  2,  1 }, false }, // 2 PT2262 长同步 (433/315)
@@ -163,46 +164,103 @@ enum {
    numProto = sizeof(proto) / sizeof(proto[0])
 };
 
-#if not defined( RCSwitchBDisableReceiving )
-VAR_ISR_ATTR volatile unsigned long RCSwitchB::nReceivedValue = 0;
-VAR_ISR_ATTR volatile unsigned int RCSwitchB::nReceivedBitlength = 0;
-VAR_ISR_ATTR volatile unsigned int RCSwitchB::nReceivedDelay = 0;
-VAR_ISR_ATTR volatile unsigned int RCSwitchB::nReceivedProtocol = 0;
-VAR_ISR_ATTR int RCSwitchB::nReceiveTolerance = 60;
-VAR_ISR_ATTR const unsigned int RCSwitchB::nSeparationLimit = 4300;
+static_assert(numProto <= 64, "protocol index masks hold at most 64 protocols");
+
+#if not defined( RCSwitchDisableReceiving )
+/*
+ * Protocol candidate index.
+ *
+ * Every protocol is classified by two timing ratios that do not depend on
+ * its base pulse length:
+ *   sync class: longest sync part / shortest data part
+ *   pair class: longest data part / shortest data part
+ * Ratios are bucketed in quarter octaves. For each bucket a bitmask records
+ * which protocols (bit p-1) may produce it, so a captured frame maps to its
+ * plausible protocols with two lookups and an AND instead of trying them all.
+ */
+#define RCSWITCH_SYNC_CLASSES 32
+#define RCSWITCH_PAIR_CLASSES 16
+// Each protocol is registered this many classes either side of its nominal
+// ratio to absorb receiver jitter (one class is roughly 19%).
+#define RCSWITCH_CLASS_SPREAD 2
+
+static uint64_t syncClassIndex[RCSWITCH_SYNC_CLASSES];
+static uint64_t pairClassIndex[RCSWITCH_PAIR_CLASSES];
+static bool protocolIndexBuilt = false;
+#endif
+
+#if not defined( RCSwitchDisableReceiving )
+VAR_ISR_ATTR int RCSwitch::nReceiveTolerance = 60;
+VAR_ISR_ATTR const unsigned int RCSwitch::nSeparationLimit = 4300;
 // separationLimit: minimum microseconds between received codes, closer codes are ignored.
 // according to discussion on issue #14 it might be more suitable to set the separation
 // limit to the same time as the 'low' part of the sync signal for the current protocol.
-VAR_ISR_ATTR unsigned int RCSwitchB::timings[RCSWITCHB_MAX_CHANGES];
+#if defined(ESP32)
+VAR_ISR_ATTR TaskHandle_t RCSwitch::notifyTask = nullptr;
+#endif
+#if !defined(ESP32) && !defined(ESP8266)
+// Platforms without attachInterruptArg() can only dispatch to one receiver.
+static RCSwitch* singleReceiver = nullptr;
+#endif
 
-// 延迟解码相关变量
-VAR_ISR_ATTR volatile bool RCSwitchB::needsDecode = false;
-VAR_ISR_ATTR volatile unsigned int RCSwitchB::savedChangeCount = 0;
+static_assert((RCSWITCH_EDGE_BUFFER_SIZE & (RCSWITCH_EDGE_BUFFER_SIZE - 1)) == 0,
+              "RCSWITCH_EDGE_BUFFER_SIZE must be a power of two");
+static_assert((RCSWITCH_FRAME_QUEUE_SIZE & (RCSWITCH_FRAME_QUEUE_SIZE - 1)) == 0,
+              "RCSWITCH_FRAME_QUEUE_SIZE must be a power of two");
+static_assert(RCSWITCH_EDGE_BUFFER_SIZE >= RCSWITCH_MAX_CHANGES,
+              "edge buffer must hold at least one full frame");
 #endif
 
-RCSwitchB::RCSwitchB() {
+RCSwitch::RCSwitch() {
   this->nTransmitterPin = -1;
+  this->player = &this->gpioPlayer;
   this->setRepeatTransmit(10);
   this->setProtocol(1);
-  #if not defined( RCSwitchBDisableReceiving )
+  #if not defined( RCSwitchDisableReceiving )
+  buildProtocolIndex();
+  memset(this->recentProtocols, 0, sizeof(this->recentProtocols));
+  this->bProtocolIndexEnabled = true;
+  this->nDecodedFrames = 0;
+  this->nDecodeAttempts = 0;
+  this->nDecodeMicros = 0;
   this->nReceiverInterrupt = -1;
   this->setReceiveTolerance(60);
-  RCSwitchB::nReceivedValue = 0;
-  RCSwitchB::needsDecode = false;
+  this->nReceivedValue = 0;
+  this->nReceivedBitlength = 0;
+  this->nReceivedDelay = 0;
+  this->nReceivedProtocol = 0;
+  this->nReceivedTimestamp = 0;
+  this->edgeHead = 0;
+  this->edgeTail = 0;
+  this->frameHead = 0;
+  this->frameTail = 0;
+  this->frameStart = 0;
+  this->frameLength = 0;
+  this->frameDiscard = true;
+  this->lastEdgeTime = 0;
+  this->nDroppedFrames = 0;
+  this->nOverflowCount = 0;
   #endif
 }
 
+/**
+  * Number of entries in the built-in protocol table (protocols 1..N).
+  */
+unsigned int RCSwitch::getProtocolCount() {
+  return numProto;
+}
+
 /**
   * Sets the protocol to send.
   */
-void RCSwitchB::setProtocol(Protocol protocol) {
+void RCSwitch::setProtocol(Protocol protocol) {
   this->protocol = protocol;
 }
 
 /**
   * Sets the protocol to send, from a list of predefined protocols
   */
-void RCSwitchB::setProtocol(int nProtocol) {
+void RCSwitch::setProtocol(int nProtocol) {
   if (nProtocol < 1 || nProtocol > numProto) {
     nProtocol = 1;  // TODO: trigger an error, e.g. "bad protocol" ???
   }
@@ -216,7 +274,7 @@ void RCSwitchB::setProtocol(int nProtocol) {
 /**
   * Sets the protocol to send with pulse length in microseconds.
   */
-void RCSwitchB::setProtocol(int nProtocol, int nPulseLength) {
+void RCSwitch::setProtocol(int nProtocol, int nPulseLength) {
   setProtocol(nProtocol);
   this->setPulseLength(nPulseLength);
 }
@@ -225,23 +283,23 @@ void RCSwitchB::setProtocol(int nProtocol, int nPulseLength) {
 /**
   * Sets pulse length in microseconds
   */
-void RCSwitchB::setPulseLength(int nPulseLength) {
+void RCSwitch::setPulseLength(int nPulseLength) {
   this->protocol.pulseLength = nPulseLength;
 }
 
 /**
  * Sets Repeat Transmits
  */
-void RCSwitchB::setRepeatTransmit(int nRepeatTransmit) {
+void RCSwitch::setRepeatTransmit(int nRepeatTransmit) {
   this->nRepeatTransmit = nRepeatTransmit;
 }
 
 /**
  * Set Receiving Tolerance
  */
-#if not defined( RCSwitchBDisableReceiving )
-void RCSwitchB::setReceiveTolerance(int nPercent) {
-  RCSwitchB::nReceiveTolerance = nPercent;
+#if not defined( RCSwitchDisableReceiving )
+void RCSwitch::setReceiveTolerance(int nPercent) {
+  RCSwitch::nReceiveTolerance = nPercent;
 }
 #endif
   
@@ -251,25 +309,47 @@ void RCSwitchB::setReceiveTolerance(int nPercent) {
  *
  * @param nTransmitterPin    Arduino Pin to which the sender is connected to
  */
-void RCSwitchB::enableTransmit(int nTransmitterPin) {
+void RCSwitch::enableTransmit(int nTransmitterPin) {
+  if (!this->player->begin(nTransmitterPin)) {
+    // 播放后端不可用时退回GPIO软件发送
+    this->player = &this->gpioPlayer;
+    this->player->begin(nTransmitterPin);
+  }
   this->nTransmitterPin = nTransmitterPin;
-  pinMode(this->nTransmitterPin, OUTPUT);
 }
 
 /**
-  * Disable transmissions
+  * Disable transmissions (waits for a pending transmission to finish)
   */
-void RCSwitchB::disableTransmit() {
+void RCSwitch::disableTransmit() {
+  if (this->nTransmitterPin != -1) {
+    this->player->end();
+  }
   this->nTransmitterPin = -1;
 }
 
+/**
+ * Select the backend that plays rendered pulse trains. Must be called
+ * before enableTransmit(); nullptr restores the blocking GPIO backend.
+ */
+void RCSwitch::setPulsePlayer(PulsePlayer* player) {
+  this->player = (player != nullptr) ? player : &this->gpioPlayer;
+}
+
+/**
+ * True while the backend is still sending the last transmission.
+ */
+bool RCSwitch::isTransmitting() {
+  return this->nTransmitterPin != -1 && this->player->busy();
+}
+
 /**
  * Switch a remote switch on (Type D REV)
  *
  * @param sGroup        Code of the switch group (A,B,C,D)
  * @param nDevice       Number of the switch itself (1..3)
  */
-void RCSwitchB::switchOn(char sGroup, int nDevice) {
+void RCSwitch::switchOn(char sGroup, int nDevice) {
   this->sendTriState( this->getCodeWordD(sGroup, nDevice, true) );
 }
 
@@ -279,7 +359,7 @@ void RCSwitchB::switchOn(char sGroup, int nDevice) {
  * @param sGroup        Code of the switch group (A,B,C,D)
  * @param nDevice       Number of the switch itself (1..3)
  */
-void RCSwitchB::switchOff(char sGroup, int nDevice) {
+void RCSwitch::switchOff(char sGroup, int nDevice) {
   this->sendTriState( this->getCodeWordD(sGroup, nDevice, false) );
 }
 
@@ -290,7 +370,7 @@ void RCSwitchB::switchOff(char sGroup, int nDevice) {
  * @param nGroup   Number of group (1..4)
  * @param nDevice  Number of device (1..4)
   */
-void RCSwitchB::switchOn(char sFamily, int nGroup, int nDevice) {
+void RCSwitch::switchOn(char sFamily, int nGroup, int nDevice) {
   this->sendTriState( this->getCodeWordC(sFamily, nGroup, nDevice, true) );
 }
 
@@ -301,7 +381,7 @@ void RCSwitchB::switchOn(char sFamily, int nGroup, int nDevice) {
  * @param nGroup   Number of group (1..4)
  * @param nDevice  Number of device (1..4)
  */
-void RCSwitchB::switchOff(char sFamily, int nGroup, int nDevice) {
+void RCSwitch::switchOff(char sFamily, int nGroup, int nDevice) {
   this->sendTriState( this->getCodeWordC(sFamily, nGroup, nDevice, false) );
 }
 
@@ -311,7 +391,7 @@ void RCSwitchB::switchOff(char sFamily, int nGroup, int nDevice) {
  * @param nAddressCode  Number of the switch group (1..4)
  * @param nChannelCode  Number of the switch itself (1..4)
  */
-void RCSwitchB::switchOn(int nAddressCode, int nChannelCode) {
+void RCSwitch::switchOn(int nAddressCode, int nChannelCode) {
   this->sendTriState( this->getCodeWordB(nAddressCode, nChannelCode, true) );
 }
 
@@ -321,7 +401,7 @@ void RCSwitchB::switchOn(int nAddressCode, int nChannelCode) {
  * @param nAddressCode  Number of the switch group (1..4)
  * @param nChannelCode  Number of the switch itself (1..4)
  */
-void RCSwitchB::switchOff(int nAddressCode, int nChannelCode) {
+void RCSwitch::switchOff(int nAddressCode, int nChannelCode) {
   this->sendTriState( this->getCodeWordB(nAddressCode, nChannelCode, false) );
 }
 
@@ -332,7 +412,7 @@ void RCSwitchB::switchOff(int nAddressCode, int nChannelCode) {
  * @param sGroup        Code of the switch group (refers to DIP switches 1..5 where "1" = on and "0" = off, if all DIP switches are on it's "11111")
  * @param nChannelCode  Number of the switch itself (1..5)
  */
-void RCSwitchB::switchOn(const char* sGroup, int nChannel) {
+void RCSwitch::switchOn(const char* sGroup, int nChannel) {
   const char* code[6] = { "00000", "10000", "01000", "00100", "00010", "00001" };
   this->switchOn(sGroup, code[nChannel]);
 }
@@ -344,7 +424,7 @@ void RCSwitchB::switchOn(const char* sGroup, int nChannel) {
  * @param sGroup        Code of the switch group (refers to DIP switches 1..5 where "1" = on and "0" = off, if all DIP switches are on it's "11111")
  * @param nChannelCode  Number of the switch itself (1..5)
  */
-void RCSwitchB::switchOff(const char* sGroup, int nChannel) {
+void RCSwitch::switchOff(const char* sGroup, int nChannel) {
   const char* code[6] = { "00000", "10000", "01000", "00100", "00010", "00001" };
   this->switchOff(sGroup, code[nChannel]);
 }
@@ -355,7 +435,7 @@ void RCSwitchB::switchOff(const char* sGroup, int nChannel) {
  * @param sGroup        Code of the switch group (refers to DIP switches 1..5 where "1" = on and "0" = off, if all DIP switches are on it's "11111")
  * @param sDevice       Code of the switch device (refers to DIP switches 6..10 (A..E) where "1" = on and "0" = off, if all DIP switches are on it's "11111")
  */
-void RCSwitchB::switchOn(const char* sGroup, const char* sDevice) {
+void RCSwitch::switchOn(const char* sGroup, const char* sDevice) {
   this->sendTriState( this->getCodeWordA(sGroup, sDevice, true) );
 }
 
@@ -365,7 +445,7 @@ void RCSwitchB::switchOn(const char* sGroup, const char* sDevice) {
  * @param sGroup        Code of the switch group (refers to DIP switches 1..5 where "1" = on and "0" = off, if all DIP switches are on it's "11111")
  * @param sDevice       Code of the switch device (refers to DIP switches 6..10 (A..E) where "1" = on and "0" = off, if all DIP switches are on it's "11111")
  */
-void RCSwitchB::switchOff(const char* sGroup, const char* sDevice) {
+void RCSwitch::switchOff(const char* sGroup, const char* sDevice) {
   this->sendTriState( this->getCodeWordA(sGroup, sDevice, false) );
 }
 
@@ -374,7 +454,7 @@ void RCSwitchB::switchOff(const char* sGroup, const char* sDevice) {
  * Returns a char[13], representing the code word to be send.
  *
  */
-char* RCSwitchB::getCodeWordA(const char* sGroup, const char* sDevice, bool bStatus) {
+char* RCSwitch::getCodeWordA(const char* sGroup, const char* sDevice, bool bStatus) {
   static char sReturn[13];
   int nReturnPos = 0;
 
@@ -410,7 +490,7 @@ char* RCSwitchB::getCodeWordA(const char* sGroup, const char* sDevice, bool bSta
  *
  * @return char[13], representing a tristate code word of length 12
  */
-char* RCSwitchB::getCodeWordB(int nAddressCode, int nChannelCode, bool bStatus) {
+char* RCSwitch::getCodeWordB(int nAddressCode, int nChannelCode, bool bStatus) {
   static char sReturn[13];
   int nReturnPos = 0;
 
@@ -439,7 +519,7 @@ char* RCSwitchB::getCodeWordB(int nAddressCode, int nChannelCode, bool bStatus)
 /**
  * Like getCodeWord (Type C = Intertechno)
  */
-char* RCSwitchB::getCodeWordC(char sFamily, int nGroup, int nDevice, bool bStatus) {
+char* RCSwitch::getCodeWordC(char sFamily, int nGroup, int nDevice, bool bStatus) {
   static char sReturn[13];
   int nReturnPos = 0;
 
@@ -489,7 +569,7 @@ char* RCSwitchB::getCodeWordC(char sFamily, int nGroup, int nDevice, bool bStatu
  *
  * @return char[13], representing a tristate code word of length 12
  */
-char* RCSwitchB::getCodeWordD(char sGroup, int nDevice, bool bStatus) {
+char* RCSwitch::getCodeWordD(char sGroup, int nDevice, bool bStatus) {
   static char sReturn[13];
   int nReturnPos = 0;
 
@@ -521,7 +601,7 @@ char* RCSwitchB::getCodeWordD(char sGroup, int nDevice, bool bStatus) {
 /**
  * @param sCodeWord   a tristate code word consisting of the letter 0, 1, F
  */
-void RCSwitchB::sendTriState(const char* sCodeWord) {
+void RCSwitch::sendTriState(const char* sCodeWord) {
   // turn the tristate code word into the corresponding bit pattern, then send it
   unsigned long code = 0;
   unsigned int length = 0;
@@ -548,7 +628,7 @@ void RCSwitchB::sendTriState(const char* sCodeWord) {
 /**
  * @param sCodeWord   a binary code word consisting of the letter 0, 1
  */
-void RCSwitchB::send(const char* sCodeWord) {
+void RCSwitch::send(const char* sCodeWord) {
   // turn the tristate code word into the corresponding bit pattern, then send it
   unsigned long code = 0;
   unsigned int length = 0;
@@ -566,11 +646,11 @@ void RCSwitchB::send(const char* sCodeWord) {
  * bits are sent from MSB to LSB, i.e., first the bit at position length-1,
  * then the bit at position length-2, and so on, till finally the bit at position 0.
  */
-void RCSwitchB::send(unsigned long code, unsigned int length) {
+void RCSwitch::send(unsigned long code, unsigned int length) {
   if (this->nTransmitterPin == -1)
     return;
 
-#if not defined( RCSwitchBDisableReceiving )
+#if not defined( RCSwitchDisableReceiving )
   // make sure the receiver is disabled while we transmit
   int nReceiverInterrupt_backup = nReceiverInterrupt;
   if (nReceiverInterrupt_backup != -1) {
@@ -578,57 +658,79 @@ void RCSwitchB::send(unsigned long code, unsigned int length) {
   }
 #endif
 
-  for (int nRepeat = 0; nRepeat < nRepeatTransmit; nRepeat++) {
-    for (int i = length-1; i >= 0; i--) {
-      if (code & (1L << i))
-        this->transmit(protocol.one);
-      else
-        this->transmit(protocol.zero);
-    }
-    this->transmit(protocol.syncFactor);
+  // 只渲染一次，重复发送交给播放后端；硬件后端会在发送完成前返回
+  // 序列超出容量时不发送，避免发出被截断的帧
+  if (!this->renderPulseTrain(code, length, this->txTrain)) {
+    return;
   }
-
-  // Disable transmit after sending (i.e., for inverted protocols)
-  digitalWrite(this->nTransmitterPin, LOW);
+  this->player->play(this->txTrain, this->nRepeatTransmit);
 
   // 注意：不再自动恢复接收模式，由调用者决定是否需要重新启用接收
   // 这样可以避免重复注册中断导致的崩溃
 }
 
 /**
- * Transmit a single high-low pulse.
+ * Render one frame of 'code' (MSB first, followed by the sync pulse) with the
+ * current protocol into a run-length pulse train. At most 32 bits are used.
+ * Returns false if the frame does not fit into the train.
  */
-void RCSwitchB::transmit(HighLow pulses) {
+bool RCSwitch::renderPulseTrain(unsigned long code, unsigned int length, PulseTrain& train) {
+  train.clear();
+  if (length > 32) {
+    length = 32;
+  }
+  for (int i = length-1; i >= 0; i--) {
+    const HighLow& pulses = (code & (1UL << i)) ? protocol.one : protocol.zero;
+    if (!this->appendPulse(train, pulses)) {
+      return false;
+    }
+  }
+  return this->appendPulse(train, protocol.syncFactor);
+}
+
+/**
+ * Append a single high-low pulse; false if the train is full.
+ */
+bool RCSwitch::appendPulse(PulseTrain& train, HighLow pulses) {
   uint8_t firstLogicLevel = (this->protocol.invertedSignal) ? LOW : HIGH;
   uint8_t secondLogicLevel = (this->protocol.invertedSignal) ? HIGH : LOW;
-  
-  digitalWrite(this->nTransmitterPin, firstLogicLevel);
-  delayMicroseconds( this->protocol.pulseLength * pulses.high);
-  digitalWrite(this->nTransmitterPin, secondLogicLevel);
-  delayMicroseconds( this->protocol.pulseLength * pulses.low);
+
+  return train.append(firstLogicLevel, (uint32_t)this->protocol.pulseLength * pulses.high) &&
+         train.append(secondLogicLevel, (uint32_t)this->protocol.pulseLength * pulses.low);
 }
 
 
-#if not defined( RCSwitchBDisableReceiving )
+#if not defined( RCSwitchDisableReceiving )
 /**
  * Enable receiving data
  */
-void RCSwitchB::enableReceive(int interrupt) {
+void RCSwitch::enableReceive(int interrupt) {
   this->nReceiverInterrupt = interrupt;
   this->enableReceive();
 }
 
-void RCSwitchB::enableReceive() {
+void RCSwitch::enableReceive() {
   if (this->nReceiverInterrupt != -1) {
-    RCSwitchB::nReceivedValue = 0;
-    RCSwitchB::nReceivedBitlength = 0;
+    this->nReceivedValue = 0;
+    this->nReceivedBitlength = 0;
+    // 中断尚未挂接，可以安全地复位环形缓冲区
+    this->edgeHead = 0;
+    this->edgeTail = 0;
+    this->frameHead = 0;
+    this->frameTail = 0;
+    this->frameStart = 0;
+    this->frameLength = 0;
+    this->frameDiscard = true;
+#if defined(ESP32) || defined(ESP8266)
+    // 所有接收器共用同一个ISR入口，通过参数区分实例
+    attachInterruptArg(digitalPinToInterrupt(this->nReceiverInterrupt), handleInterrupt, this, CHANGE);
+#else
+    singleReceiver = this;
 #if defined(RaspberryPi) // Raspberry Pi
-    wiringPiISR(this->nReceiverInterrupt, INT_EDGE_BOTH, &handleInterrupt);
-#elif defined(ESP32)
-    // ESP32 需要使用 digitalPinToInterrupt 转换
-    attachInterrupt(digitalPinToInterrupt(this->nReceiverInterrupt), handleInterrupt, CHANGE);
+    wiringPiISR(this->nReceiverInterrupt, INT_EDGE_BOTH, &handleSingleInterrupt);
 #else // Arduino
-    attachInterrupt(this->nReceiverInterrupt, handleInterrupt, CHANGE);
+    attachInterrupt(this->nReceiverInterrupt, handleSingleInterrupt, CHANGE);
+#endif
 #endif
   }
 }
@@ -636,11 +738,11 @@ void RCSwitchB::enableReceive() {
 /**
  * Disable receiving data
  */
-void RCSwitchB::disableReceive() {
+void RCSwitch::disableReceive() {
 #if not defined(RaspberryPi) // Arduino
   // 只有在有效的中断号时才detach，避免GPIO错误
   if (this->nReceiverInterrupt != -1) {
-#if defined(ESP32)
+#if defined(ESP32) || defined(ESP8266)
     detachInterrupt(digitalPinToInterrupt(this->nReceiverInterrupt));
 #else
     detachInterrupt(this->nReceiverInterrupt);
@@ -650,34 +752,65 @@ void RCSwitchB::disableReceive() {
   this->nReceiverInterrupt = -1;
 }
 
-bool RCSwitchB::available() {
-  return RCSwitchB::nReceivedValue != 0;
+bool RCSwitch::available() {
+  return this->nReceivedValue != 0;
+}
+
+void RCSwitch::resetAvailable() {
+  this->nReceivedValue = 0;
 }
 
-void RCSwitchB::resetAvailable() {
-  RCSwitchB::nReceivedValue = 0;
+unsigned long RCSwitch::getReceivedValue() {
+  return this->nReceivedValue;
 }
 
-unsigned long RCSwitchB::getReceivedValue() {
-  return RCSwitchB::nReceivedValue;
+unsigned int RCSwitch::getReceivedBitlength() {
+  return this->nReceivedBitlength;
 }
 
-unsigned int RCSwitchB::getReceivedBitlength() {
-  return RCSwitchB::nReceivedBitlength;
+unsigned int RCSwitch::getReceivedDelay() {
+  return this->nReceivedDelay;
 }
 
-unsigned int RCSwitchB::getReceivedDelay() {
-  return RCSwitchB::nReceivedDelay;
+unsigned int RCSwitch::getReceivedProtocol() {
+  return this->nReceivedProtocol;
 }
 
-unsigned int RCSwitchB::getReceivedProtocol() {
-  return RCSwitchB::nReceivedProtocol;
+unsigned int* RCSwitch::getReceivedRawdata() {
+  return this->timings;
 }
 
-unsigned int* RCSwitchB::getReceivedRawdata() {
-  return RCSwitchB::timings;
+/**
+ * Number of complete frames thrown away because the frame queue was full.
+ */
+uint32_t RCSwitch::getDroppedFrameCount() {
+  return this->nDroppedFrames;
+}
+
+/**
+ * Number of captures lost because the edge ring buffer was full.
+ */
+uint32_t RCSwitch::getOverflowCount() {
+  return this->nOverflowCount;
 }
 
+/**
+ * micros() of the last edge of the frame that produced the received value.
+ */
+uint32_t RCSwitch::getReceivedTimestamp() {
+  return this->nReceivedTimestamp;
+}
+
+#if defined(ESP32)
+/**
+ * Task to wake with a task notification whenever a complete frame is queued.
+ * Pass nullptr to stop notifying.
+ */
+void RCSwitch::setNotifyTask(TaskHandle_t task) {
+  RCSwitch::notifyTask = task;
+}
+#endif
+
 /* helper function for the receiveProtocol method */
 // 使用内联实现替代 abs()，因为标准库 abs() 可能不在 IRAM 中
 static inline unsigned int RECEIVE_ATTR diff(int A, int B) {
@@ -688,7 +821,7 @@ static inline unsigned int RECEIVE_ATTR diff(int A, int B) {
 /**
  *
  */
-bool RCSwitchB::receiveProtocol(const int p, unsigned int changeCount) {
+bool RCSwitch::receiveProtocol(const int p, unsigned int changeCount) {
     // 必须复制到栈上，避免中断时访问 Flash (proto 在 RODATA 段)
     Protocol pro;
 #if defined(ESP8266) || defined(ESP32)
@@ -700,8 +833,8 @@ bool RCSwitchB::receiveProtocol(const int p, unsigned int changeCount) {
     unsigned long code = 0;
     //Assuming the longer pulse length is the pulse captured in timings[0]
     const unsigned int syncLengthInPulses =  ((pro.syncFactor.low) > (pro.syncFactor.high)) ? (pro.syncFactor.low) : (pro.syncFactor.high);
-    const unsigned int delay = RCSwitchB::timings[0] / syncLengthInPulses;
-    const unsigned int delayTolerance = delay * RCSwitchB::nReceiveTolerance / 100;
+    const unsigned int delay = this->timings[0] / syncLengthInPulses;
+    const unsigned int delayTolerance = delay * RCSwitch::nReceiveTolerance / 100;
     
     /* For protocols that start low, the sync period looks like
      *               _________
@@ -724,11 +857,11 @@ bool RCSwitchB::receiveProtocol(const int p, unsigned int changeCount) {
 
     for (unsigned int i = firstDataTiming; i < changeCount - 1; i += 2) {
         code <<= 1;
-        if (diff(RCSwitchB::timings[i], delay * pro.zero.high) < delayTolerance &&
-            diff(RCSwitchB::timings[i + 1], delay * pro.zero.low) < delayTolerance) {
+        if (diff(this->timings[i], delay * pro.zero.high) < delayTolerance &&
+            diff(this->timings[i + 1], delay * pro.zero.low) < delayTolerance) {
             // zero
-        } else if (diff(RCSwitchB::timings[i], delay * pro.one.high) < delayTolerance &&
-                   diff(RCSwitchB::timings[i + 1], delay * pro.one.low) < delayTolerance) {
+        } else if (diff(this->timings[i], delay * pro.one.high) < delayTolerance &&
+                   diff(this->timings[i + 1], delay * pro.one.low) < delayTolerance) {
             // one
             code |= 1;
         } else {
@@ -738,89 +871,351 @@ bool RCSwitchB::receiveProtocol(const int p, unsigned int changeCount) {
     }
 
     if (changeCount > 7) {    // ignore very short transmissions: no device sends them, so this must be noise
-        RCSwitchB::nReceivedValue = code;
-        RCSwitchB::nReceivedBitlength = (changeCount - 1) / 2;
-        RCSwitchB::nReceivedDelay = delay;
-        RCSwitchB::nReceivedProtocol = p;
+        this->nReceivedValue = code;
+        this->nReceivedBitlength = (changeCount - 1) / 2;
+        this->nReceivedDelay = delay;
+        this->nReceivedProtocol = p;
         return true;
     }
 
     return false;
 }
 
-void RECEIVE_ATTR RCSwitchB::handleInterrupt() {
+/**
+ * Hand the frame currently being captured over to the decoder.
+ * Called from the ISR only.
+ */
+void RECEIVE_ATTR RCSwitch::publishFrame(uint32_t endTime) {
+  const uint32_t head = this->frameHead;
+  if (head - __atomic_load_n(&this->frameTail, __ATOMIC_ACQUIRE) >= RCSWITCH_FRAME_QUEUE_SIZE) {
+    // 解码器来不及处理，丢弃本帧并回收其边沿记录
+    this->nDroppedFrames++;
+    this->edgeHead = this->frameStart;
+    return;
+  }
+  FrameSlot& slot = this->frameQueue[head & (RCSWITCH_FRAME_QUEUE_SIZE - 1)];
+  slot.start = this->frameStart;
+  slot.count = this->frameLength;
+  slot.endTime = endTime;
+  // release: 帧描述和边沿记录必须先于frameHead对解码器可见
+  __atomic_store_n(&this->frameHead, head + 1, __ATOMIC_RELEASE);
+
+#if defined(ESP32)
+  // 直接唤醒解码任务，无需轮询
+  if (RCSwitch::notifyTask != nullptr) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(RCSwitch::notifyTask, &xHigherPriorityTaskWoken);
+    if (xHigherPriorityTaskWoken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+#endif
+}
+
+/**
+ * Shared interrupt entry for every receiver instance; "arg" is the RCSwitch
+ * registered with attachInterruptArg().
+ */
+void RECEIVE_ATTR RCSwitch::handleInterrupt(void* arg) {
+  static_cast<RCSwitch*>(arg)->handleEdge();
+}
 
-  static unsigned int changeCount = 0;
-  static unsigned long lastTime = 0;
-  static unsigned int repeatCount = 0;
+#if !defined(ESP32) && !defined(ESP8266)
+void RECEIVE_ATTR RCSwitch::handleSingleInterrupt() {
+  if (singleReceiver != nullptr) {
+    singleReceiver->handleEdge();
+  }
+}
+#endif
+
+void RECEIVE_ATTR RCSwitch::handleEdge() {
 
   const long time = micros();
-  const unsigned int duration = time - lastTime;
+  const unsigned int duration = time - this->lastEdgeTime;
+  this->lastEdgeTime = time;
 
-  if (duration > RCSwitchB::nSeparationLimit) {
+  if (duration > RCSwitch::nSeparationLimit) {
     // A long stretch without signal level change occurred. This could
-    // be the gap between two transmission.
-    if ((repeatCount==0) || (diff(duration, RCSwitchB::timings[0]) < 200)) {
-      // This long signal is close in length to the long signal which
-      // started the previously recorded timings; this suggests that
-      // it may indeed by a a gap between two transmissions (we assume
-      // here that a sender will send the signal multiple times,
-      // with roughly the same gap between them).
-      repeatCount++;
-      if (repeatCount == 2) {
-        // 不在ISR中解码，只设置标志让外部任务处理
-        if (!RCSwitchB::needsDecode && changeCount > 7) {
-          RCSwitchB::savedChangeCount = changeCount;
-          RCSwitchB::needsDecode = true;
-        }
-        repeatCount = 0;
-      }
+    // be the gap between two transmissions. The frame it closes is only
+    // published if the gap is close in length to the one which started it
+    // (we assume here that a sender will send the signal multiple times,
+    // with roughly the same gap between them).
+    const uint32_t sync = this->edgeBuffer[this->frameStart & (RCSWITCH_EDGE_BUFFER_SIZE - 1)];
+    if (!this->frameDiscard && this->frameLength > 7 &&
+        diff(duration, sync) < 200) {
+      this->publishFrame(time);
+    } else {
+      this->edgeHead = this->frameStart;
     }
-    changeCount = 0;
+    // this gap becomes the sync timing of the next frame
+    this->frameStart = this->edgeHead;
+    this->frameLength = 0;
+    this->frameDiscard = false;
+  }
+
+  if (this->frameDiscard) {
+    return;
+  }
+
+  // detect overflow: too many changes for a frame, wait for the next gap
+  if (this->frameLength >= RCSWITCH_MAX_CHANGES) {
+    this->edgeHead = this->frameStart;
+    this->frameDiscard = true;
+    return;
   }
- 
-  // detect overflow
-  if (changeCount >= RCSWITCHB_MAX_CHANGES) {
-    changeCount = 0;
-    repeatCount = 0;
+
+  // ring full: the decoder still owns older frames, drop this capture
+  if (this->edgeHead - __atomic_load_n(&this->edgeTail, __ATOMIC_ACQUIRE) >= RCSWITCH_EDGE_BUFFER_SIZE) {
+    this->nOverflowCount++;
+    this->edgeHead = this->frameStart;
+    this->frameDiscard = true;
+    return;
   }
 
-  RCSwitchB::timings[changeCount++] = duration;
-  lastTime = time;  
+  this->edgeBuffer[this->edgeHead & (RCSWITCH_EDGE_BUFFER_SIZE - 1)] = duration;
+  this->edgeHead++;
+  this->frameLength++;
 }
 
-// 在非ISR上下文中调用进行解码
-void RCSwitchB::tryDecode() {
-  if (!RCSwitchB::needsDecode) {
+/**
+ * Copy the oldest published frame into timings[] and release its ring space.
+ * Called from the decoding task only.
+ */
+bool RCSwitch::popFrame(unsigned int& changeCount, uint32_t& endTime) {
+  const uint32_t tail = this->frameTail;
+  if (tail == __atomic_load_n(&this->frameHead, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+
+  const FrameSlot slot = this->frameQueue[tail & (RCSWITCH_FRAME_QUEUE_SIZE - 1)];
+  for (unsigned int i = 0; i < slot.count; i++) {
+    this->timings[i] = this->edgeBuffer[(slot.start + i) & (RCSWITCH_EDGE_BUFFER_SIZE - 1)];
+  }
+  changeCount = slot.count;
+  endTime = slot.endTime;
+
+  // release: 读取完成后才把空间交还给ISR
+  __atomic_store_n(&this->edgeTail, slot.start + slot.count, __ATOMIC_RELEASE);
+  __atomic_store_n(&this->frameTail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+/**
+ * Quarter-octave bucket of num/den, i.e. roughly 4*log2(num/den).
+ */
+static unsigned int ratioClass(uint32_t num, uint32_t den, unsigned int classes) {
+  if (den == 0 || num <= den) {
+    return 0;
+  }
+  const uint32_t q = (num << 8) / den;           // Q8, > 256
+  const int msb = 31 - __builtin_clz(q);          // >= 8
+  const unsigned int frac = (q >> (msb - 2)) & 0x3;
+  const unsigned int cls = (msb - 8) * 4 + frac;
+  return (cls < classes) ? cls : classes - 1;
+}
+
+static void addClassRange(uint64_t* index, unsigned int classes, unsigned int cls, uint64_t bit) {
+  const int lo = (int)cls - RCSWITCH_CLASS_SPREAD;
+  const int hi = (int)cls + RCSWITCH_CLASS_SPREAD;
+  for (int c = (lo < 0 ? 0 : lo); c <= hi && c < (int)classes; c++) {
+    index[c] |= bit;
+  }
+}
+
+/**
+ * Fill the sync/pair class masks from proto[]. Runs once.
+ */
+void RCSwitch::buildProtocolIndex() {
+  if (protocolIndexBuilt) {
     return;
   }
-  
-  unsigned int changeCount = RCSwitchB::savedChangeCount;
-  
-  for(unsigned int i = 1; i <= numProto; i++) {
-    if (receiveProtocol(i, changeCount)) {
-      // receive succeeded for protocol i
-      RCSwitchB::needsDecode = false;
-      return;
+  memset(syncClassIndex, 0, sizeof(syncClassIndex));
+  memset(pairClassIndex, 0, sizeof(pairClassIndex));
+
+  for (unsigned int p = 0; p < numProto; p++) {
+    const Protocol& pro = proto[p];
+    const uint64_t bit = 1ULL << p;
+    const unsigned int sync = (pro.syncFactor.low > pro.syncFactor.high) ? pro.syncFactor.low : pro.syncFactor.high;
+
+    // A frame may contain only zeros, only ones or both, and the shortest/
+    // longest data part differs between those cases for asymmetric protocols.
+    const HighLow* variants[3][2] = {
+      { &pro.zero, &pro.one }, { &pro.zero, &pro.zero }, { &pro.one, &pro.one }
+    };
+    for (unsigned int v = 0; v < 3; v++) {
+      unsigned int shortest = 255, longest = 1;
+      for (unsigned int k = 0; k < 2; k++) {
+        const HighLow* hl = variants[v][k];
+        const unsigned int lo = (hl->high < hl->low) ? hl->high : hl->low;
+        const unsigned int hi = (hl->high > hl->low) ? hl->high : hl->low;
+        if (lo < shortest) shortest = lo;
+        if (hi > longest) longest = hi;
+      }
+      if (shortest == 0) {
+        shortest = 1;
+      }
+      addClassRange(syncClassIndex, RCSWITCH_SYNC_CLASSES, ratioClass(sync, shortest, RCSWITCH_SYNC_CLASSES), bit);
+      addClassRange(pairClassIndex, RCSWITCH_PAIR_CLASSES, ratioClass(longest, shortest, RCSWITCH_PAIR_CLASSES), bit);
     }
   }
-  
+  protocolIndexBuilt = true;
+}
+
+/**
+ * Enable or disable the candidate index for this receiver; when disabled
+ * every protocol is tried in table order, as the original rc-switch decoder
+ * does. The index tables themselves are shared and never change.
+ */
+void RCSwitch::setProtocolIndexEnabled(bool enabled) {
+  this->bProtocolIndexEnabled = enabled;
+}
+
+bool RCSwitch::isProtocolIndexEnabled() {
+  return this->bProtocolIndexEnabled;
+}
+
+/**
+ * Bitmask (bit p-1 for protocol p) of protocols plausible for the frame in
+ * timings[].
+ */
+uint64_t RCSwitch::findProtocolCandidates(unsigned int changeCount) {
+  if (!this->bProtocolIndexEnabled || changeCount < 5) {
+    return (numProto >= 64) ? ~0ULL : ((1ULL << numProto) - 1);
+  }
+
+  // timings[2..changeCount-2] are data parts for both normal and inverted
+  // protocols; timings[1] and timings[changeCount-1] may belong to the sync.
+  unsigned int shortest = 0xFFFFFFFFu, longest = 0;
+  for (unsigned int i = 2; i < changeCount - 1; i++) {
+    const unsigned int t = this->timings[i];
+    if (t < shortest) shortest = t;
+    if (t > longest) longest = t;
+  }
+
+  return syncClassIndex[ratioClass(this->timings[0], shortest, RCSWITCH_SYNC_CLASSES)] &
+         pairClassIndex[ratioClass(longest, shortest, RCSWITCH_PAIR_CLASSES)];
+}
+
+/**
+ * Try one candidate protocol and keep the most recently matched list in
+ * move-to-front order on success.
+ */
+bool RCSwitch::tryProtocol(unsigned int p, unsigned int changeCount) {
+  this->nDecodeAttempts++;
+  if (!receiveProtocol(p, changeCount)) {
+    return false;
+  }
+
+  unsigned int pos = RCSWITCH_RECENT_PROTOCOLS - 1;
+  for (unsigned int i = 0; i < RCSWITCH_RECENT_PROTOCOLS; i++) {
+    if (this->recentProtocols[i] == p) {
+      pos = i;
+      break;
+    }
+  }
+  for (; pos > 0; pos--) {
+    this->recentProtocols[pos] = this->recentProtocols[pos - 1];
+  }
+  this->recentProtocols[0] = p;
+  return true;
+}
+
+/**
+ * Decode the frame in timings[]: recently matched candidates first, then
+ * the remaining candidates in table order, then protocol inference.
+ */
+bool RCSwitch::decodeFrame(unsigned int changeCount) {
+  uint64_t candidates = findProtocolCandidates(changeCount);
+
+  for (unsigned int i = 0; i < RCSWITCH_RECENT_PROTOCOLS; i++) {
+    const unsigned int p = this->recentProtocols[i];
+    if (p == 0 || !(candidates & (1ULL << (p - 1)))) {
+      continue;
+    }
+    candidates &= ~(1ULL << (p - 1));
+    if (tryProtocol(p, changeCount)) {
+      return true;
+    }
+  }
+
+  while (candidates != 0) {
+    const unsigned int p = __builtin_ctzll(candidates) + 1;
+    candidates &= candidates - 1;
+    if (tryProtocol(p, changeCount)) {
+      // receive succeeded for protocol p
+      return true;
+    }
+  }
+
   // 尝试动态推断协议
-  if (inferAndDecode(changeCount)) {
-    // note: nReceivedProtocol == 0 indicates a dynamically inferred protocol
+  // note: nReceivedProtocol == 0 indicates a dynamically inferred protocol
+  return inferAndDecode(changeCount);
+}
+
+/**
+ * Decoder cost counters: frames handled, receiveProtocol() attempts and
+ * total decode time in microseconds since the last reset.
+ */
+void RCSwitch::getDecodeStats(uint32_t& frames, uint32_t& attempts, uint32_t& micros) {
+  frames = this->nDecodedFrames;
+  attempts = this->nDecodeAttempts;
+  micros = this->nDecodeMicros;
+}
+
+void RCSwitch::resetDecodeStats() {
+  this->nDecodedFrames = 0;
+  this->nDecodeAttempts = 0;
+  this->nDecodeMicros = 0;
+}
+
+/**
+ * Decode a capture supplied by the caller instead of the receiver, in the
+ * same layout as timings[] (sync gap first). Used to replay recorded or
+ * synthetic frames; the decode statistics are updated as for live frames.
+ * The receive queues are not touched, so do not call this on an instance
+ * that is receiving.
+ */
+bool RCSwitch::decodeCapture(const unsigned int* captured, unsigned int changeCount) {
+  if (changeCount > RCSWITCH_MAX_CHANGES) {
+    return false;
+  }
+  memcpy(this->timings, captured, changeCount * sizeof(unsigned int));
+  this->nReceivedValue = 0;
+
+  const uint32_t start = micros();
+  const bool decoded = decodeFrame(changeCount);
+  this->nDecodeMicros += micros() - start;
+  this->nDecodedFrames++;
+  return decoded;
+}
+
+// 在非ISR上下文中调用进行解码
+void RCSwitch::tryDecode() {
+  unsigned int changeCount = 0;
+  uint32_t endTime = 0;
+
+  // 上一个结果尚未被取走时不覆盖它，帧留在队列中等待下次解码
+  while (this->nReceivedValue == 0 && popFrame(changeCount, endTime)) {
+    const uint32_t start = micros();
+    const bool decoded = decodeFrame(changeCount);
+    this->nDecodeMicros += micros() - start;
+    this->nDecodedFrames++;
+
+    if (decoded) {
+      this->nReceivedTimestamp = endTime;
+      return;
+    }
   }
-  
-  RCSwitchB::needsDecode = false;
 }
 #endif
 
 // Heuristic: infer base pulse length from timings[] captured.
 // Returns inferred pulseLength in microseconds (rounded).
-unsigned int RCSwitchB::inferPulseLengthFromTimings(unsigned int changeCount) {
+unsigned int RCSwitch::inferPulseLengthFromTimings(unsigned int changeCount) {
     // Find smallest nonzero timing (filter noise)
     unsigned int minT = 0xFFFFFFFFu;
     for (unsigned int i = 0; i < changeCount; ++i) {
-        unsigned int t = RCSwitchB::timings[i];
+        unsigned int t = this->timings[i];
         if (t > 20 && t < minT) minT = t;
     }
     if (minT == 0xFFFFFFFFu) return 350; // fallback
@@ -835,9 +1230,9 @@ unsigned int RCSwitchB::inferPulseLengthFromTimings(unsigned int changeCount) {
         // check how well timings align to multiples of cand
         int matches = 0;
         for (unsigned int i = 0; i < changeCount; ++i) {
-            unsigned int q = (RCSwitchB::timings[i] + cand/2) / cand;
+            unsigned int q = (this->timings[i] + cand/2) / cand;
             unsigned int approx = q * cand;
-            unsigned int diff = (approx > RCSwitchB::timings[i]) ? approx - RCSwitchB::timings[i] : RCSwitchB::timings[i] - approx;
+            unsigned int diff = (approx > this->timings[i]) ? approx - this->timings[i] : this->timings[i] - approx;
             if (diff < cand / 3) matches++;
         }
         if (matches > (int)(changeCount * 0.6)) { best = cand; break; }
@@ -847,8 +1242,8 @@ unsigned int RCSwitchB::inferPulseLengthFromTimings(unsigned int changeCount) {
 }
 
 // Try to infer a Protocol from captured timings and decode.
-// If successful, it sets RCSwitch::nReceivedValue / nReceivedBitlength etc and returns true.
-bool RCSwitchB::inferAndDecode(unsigned int changeCount) {
+// If successful, it sets this->nReceivedValue / nReceivedBitlength etc and returns true.
+bool RCSwitch::inferAndDecode(unsigned int changeCount) {
     if (changeCount < 6) return false;
 
     unsigned int base = inferPulseLengthFromTimings(changeCount);
@@ -862,8 +1257,8 @@ bool RCSwitchB::inferAndDecode(unsigned int changeCount) {
     int pairIdx = 0;
 
     for (unsigned int i = 1; i < changeCount - 1; i += 2) {
-        unsigned int high = (RCSwitchB::timings[i] + base/2) / base;
-        unsigned int low  = (RCSwitchB::timings[i+1] + base/2) / base;
+        unsigned int high = (this->timings[i] + base/2) / base;
+        unsigned int low  = (this->timings[i+1] + base/2) / base;
         if (high == 0) high = 1;
         if (low == 0) low = 1;
         unsigned int key = (high << 8) | (low & 0xFF);
@@ -898,10 +1293,10 @@ bool RCSwitchB::inferAndDecode(unsigned int changeCount) {
     unsigned int key1 = pairKeys[top2];
 
     // compose guessed Protocol
-    RCSwitchB::Protocol guess;
+    RCSwitch::Protocol guess;
     guess.pulseLength = base;
     guess.syncFactor.high = 1;
-    guess.syncFactor.low  = (RCSwitchB::timings[0] + base/2) / base; // heuristic: long low after initial high
+    guess.syncFactor.low  = (this->timings[0] + base/2) / base; // heuristic: long low after initial high
     guess.invertedSignal = false;
 
     // decode attempt helper using guessed mapping of which key => zero/one
@@ -909,7 +1304,7 @@ bool RCSwitchB::inferAndDecode(unsigned int changeCount) {
         unsigned long code = 0;
         unsigned int bitlen = 0;
         const unsigned int delay = base;
-        const unsigned int delayTolerance = delay * RCSwitchB::nReceiveTolerance / 100;
+        const unsigned int delayTolerance = delay * RCSwitch::nReceiveTolerance / 100;
 
         // fill guess.zero/one
         guess.zero.high = (key_zero >> 8) & 0xFF;
@@ -919,8 +1314,8 @@ bool RCSwitchB::inferAndDecode(unsigned int changeCount) {
 
         // attempt to parse pairs
         for (unsigned int i = 1; i < changeCount - 1; i += 2) {
-            unsigned int h = (RCSwitchB::timings[i] + base/2) / base;
-            unsigned int l = (RCSwitchB::timings[i+1] + base/2) / base;
+            unsigned int h = (this->timings[i] + base/2) / base;
+            unsigned int l = (this->timings[i+1] + base/2) / base;
 
             // match zero?
             if ( (h == guess.zero.high && l == guess.zero.low) ) {
@@ -941,11 +1336,11 @@ bool RCSwitchB::inferAndDecode(unsigned int changeCount) {
         }
 
         if (bitlen > 8) { // reasonable min bitlength
-            RCSwitchB::nReceivedValue = code;
-            RCSwitchB::nReceivedBitlength = bitlen;
-            RCSwitchB::nReceivedDelay = base;
+            this->nReceivedValue = code;
+            this->nReceivedBitlength = bitlen;
+            this->nReceivedDelay = base;
             // we cannot set a protocol index here — mark as 0 for 'dynamic'
-            RCSwitchB::nReceivedProtocol = 0; 
+            this->nReceivedProtocol = 0; 
             return true;
         }
         return false;
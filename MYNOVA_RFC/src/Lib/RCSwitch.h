@@ -1,5 +1,5 @@
 /*
-  RCSwitchA - Arduino libary for remote control outlet switches
+  RCSwitch - Arduino libary for remote control outlet switches
   Copyright (c) 2011 Suat Özgür.  All right reserved.
 
   Contributors:
@@ -27,8 +27,8 @@
   License along with this library; if not, write to the Free Software
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
-#ifndef _RCSwitchA_h
-#define _RCSwitchA_h
+#ifndef _RCSwitch_h
+#define _RCSwitch_h
 
 #if defined(ARDUINO) && ARDUINO >= 100
     #include "Arduino.h"
@@ -48,22 +48,33 @@
 #endif
 
 #include <stdint.h>
+#include "PulsePlayer.h"
 
 
 // At least for the ATTiny X4/X5, receiving has to be disabled due to
 // missing libm depencies (udivmodhi4)
 #if defined( __AVR_ATtinyX5__ ) or defined ( __AVR_ATtinyX4__ )
-#define RCSwitchADisableReceiving
+#define RCSwitchDisableReceiving
 #endif
 
 // Number of maximum high/Low changes per packet.
 // We can handle up to (unsigned long) => 32 bit * 2 H/L changes per bit + 2 for sync
-#define RCSWITCHA_MAX_CHANGES 67
+#define RCSWITCH_MAX_CHANGES 67
 
-class RCSwitchA {
+// Capacity of the ISR -> decoder edge ring buffer (durations, power of two).
+// Enough for several complete frames so captures survive a slow decoder.
+#define RCSWITCH_EDGE_BUFFER_SIZE 256
+
+// Capacity of the completed-frame queue (frames, power of two).
+#define RCSWITCH_FRAME_QUEUE_SIZE 8
+
+// Number of recently matched protocols tried before other candidates.
+#define RCSWITCH_RECENT_PROTOCOLS 4
+
+class RCSwitch {
 
   public:
-    RCSwitchA();
+    RCSwitch();
     
     void switchOn(int nGroupNumber, int nSwitchNumber);
     void switchOff(int nGroupNumber, int nSwitchNumber);
@@ -80,7 +91,7 @@ class RCSwitchA {
     void send(unsigned long code, unsigned int length);
     void send(const char* sCodeWord);
     
-    #if not defined( RCSwitchADisableReceiving )
+    #if not defined( RCSwitchDisableReceiving )
     void enableReceive(int interrupt);
     void enableReceive();
     void disableReceive();
@@ -92,13 +103,27 @@ class RCSwitchA {
     unsigned int getReceivedDelay();
     unsigned int getReceivedProtocol();
     unsigned int* getReceivedRawdata();
+    uint32_t getDroppedFrameCount();
+    uint32_t getOverflowCount();
+    uint32_t getReceivedTimestamp();
+    void getDecodeStats(uint32_t& frames, uint32_t& attempts, uint32_t& micros);
+    void resetDecodeStats();
+    void setProtocolIndexEnabled(bool enabled);
+    bool isProtocolIndexEnabled();
+    bool decodeCapture(const unsigned int* captured, unsigned int changeCount);
+    #if defined(ESP32)
+    static void setNotifyTask(TaskHandle_t task);
+    #endif
     #endif
   
     void enableTransmit(int nTransmitterPin);
     void disableTransmit();
+    void setPulsePlayer(PulsePlayer* player);
+    bool isTransmitting();
+    bool renderPulseTrain(unsigned long code, unsigned int length, PulseTrain& train);
     void setPulseLength(int nPulseLength);
     void setRepeatTransmit(int nRepeatTransmit);
-    #if not defined( RCSwitchADisableReceiving )
+    #if not defined( RCSwitchDisableReceiving )
     void setReceiveTolerance(int nPercent); 
     #endif
 
@@ -128,7 +153,7 @@ class RCSwitchA {
         /**
          * If true, interchange high and low logic levels in all transmissions.
          *
-         * By default, RCSwitchA assumes that any signals it sends or receives
+         * By default, RCSwitch assumes that any signals it sends or receives
          * can be broken down into pulses which start with a high signal level,
          * followed by a a low signal level. This is e.g. the case for the
          * popular PT 2260 encoder chip, and thus many switches out there.
@@ -136,7 +161,7 @@ class RCSwitchA {
          * But some devices do it the other way around, and start with a low
          * signal level, followed by a high signal level, e.g. the HT6P20B. To
          * accommodate this, one can set invertedSignal to true, which causes
-         * RCSwitchA to change how it interprets any HighLow struct FOO: It will
+         * RCSwitch to change how it interprets any HighLow struct FOO: It will
          * then assume transmissions start with a low signal lasting
          * FOO.high*pulseLength microseconds, followed by a high signal lasting
          * FOO.low*pulseLength microseconds.
@@ -147,20 +172,41 @@ class RCSwitchA {
     void setProtocol(Protocol protocol);
     void setProtocol(int nProtocol);
     void setProtocol(int nProtocol, int nPulseLength);
-    static void tryDecode();                 // 在非ISR上下文中调用进行解码
+    static unsigned int getProtocolCount();
+    void tryDecode();                        // 在非ISR上下文中调用进行解码
+
+    /**
+     * A complete frame published by the ISR: "count" edge durations starting
+     * at ring position "start" (free-running, masked on access).
+     */
+    struct FrameSlot {
+        uint32_t start;
+        uint16_t count;
+        uint32_t endTime;   // micros() of the gap edge that closed the frame
+    };
 
   private:
     char* getCodeWordA(const char* sGroup, const char* sDevice, bool bStatus);
     char* getCodeWordB(int nGroupNumber, int nSwitchNumber, bool bStatus);
     char* getCodeWordC(char sFamily, int nGroup, int nDevice, bool bStatus);
     char* getCodeWordD(char group, int nDevice, bool bStatus);
-    void transmit(HighLow pulses);
+    bool appendPulse(PulseTrain& train, HighLow pulses);
 
-    #if not defined( RCSwitchADisableReceiving )
-    static void handleInterrupt();
-    static bool receiveProtocol(const int p, unsigned int changeCount);
-    static unsigned int inferPulseLengthFromTimings(unsigned int changeCount);
-    static bool inferAndDecode(unsigned int changeCount);
+    #if not defined( RCSwitchDisableReceiving )
+    static void handleInterrupt(void* arg);
+    #if !defined(ESP32) && !defined(ESP8266)
+    static void handleSingleInterrupt();
+    #endif
+    void handleEdge();
+    static void buildProtocolIndex();
+    uint64_t findProtocolCandidates(unsigned int changeCount);
+    bool tryProtocol(unsigned int p, unsigned int changeCount);
+    bool decodeFrame(unsigned int changeCount);
+    bool receiveProtocol(const int p, unsigned int changeCount);
+    unsigned int inferPulseLengthFromTimings(unsigned int changeCount);
+    bool inferAndDecode(unsigned int changeCount);
+    void publishFrame(uint32_t endTime);
+    bool popFrame(unsigned int& changeCount, uint32_t& endTime);
     int nReceiverInterrupt;
     #endif
     int nTransmitterPin;
@@ -168,21 +214,60 @@ class RCSwitchA {
     
     Protocol protocol;
 
-    #if not defined( RCSwitchADisableReceiving )
+    GpioPulsePlayer gpioPlayer;              // 默认播放后端（阻塞式GPIO）
+    PulsePlayer* player;                     // 当前播放后端
+    PulseTrain txTrain;                      // 最近一次渲染的发送序列
+
+    #if not defined( RCSwitchDisableReceiving )
     static int nReceiveTolerance;
-    volatile static unsigned long nReceivedValue;
-    volatile static unsigned int nReceivedBitlength;
-    volatile static unsigned int nReceivedDelay;
-    volatile static unsigned int nReceivedProtocol;
     const static unsigned int nSeparationLimit;
+
+    /*
+     * Receive state is kept per instance so any number of receivers can run
+     * side by side; all of them share handleInterrupt() and the decoder code.
+     */
+    volatile unsigned long nReceivedValue;
+    volatile unsigned int nReceivedBitlength;
+    volatile unsigned int nReceivedDelay;
+    volatile unsigned int nReceivedProtocol;
+    volatile uint32_t nReceivedTimestamp;
     /* 
-     * timings[0] contains sync timing, followed by a number of bits
+     * timings[0] contains sync timing, followed by a number of bits.
+     * Only touched by the decoder, which copies each frame out of the ring.
      */
-    static unsigned int timings[RCSWITCHA_MAX_CHANGES];
-    
-    // 延迟解码相关变量
-    volatile static bool needsDecode;        // ISR设置此标志表示需要解码
-    volatile static unsigned int savedChangeCount;  // 保存的changeCount用于解码
+    unsigned int timings[RCSWITCH_MAX_CHANGES];
+
+    /*
+     * ISR -> decoder single-producer/single-consumer queues.
+     * The ISR is the only writer of edgeHead/frameHead, tryDecode() the only
+     * writer of edgeTail/frameTail, so no lock is needed between them.
+     */
+    uint32_t edgeBuffer[RCSWITCH_EDGE_BUFFER_SIZE];  // 每个边沿之前电平持续的微秒数
+    FrameSlot frameQueue[RCSWITCH_FRAME_QUEUE_SIZE];
+    uint32_t edgeHead;                       // ISR写入位置（含未完成帧）
+    volatile uint32_t edgeTail;              // 解码器已消费位置
+    volatile uint32_t frameHead;             // ISR已发布帧数
+    volatile uint32_t frameTail;             // 解码器已消费帧数
+
+    // ISR中正在采集的帧
+    uint32_t frameStart;
+    unsigned int frameLength;
+    bool frameDiscard;
+    unsigned long lastEdgeTime;
+
+    volatile uint32_t nDroppedFrames;        // 帧队列已满而丢弃的完整帧
+    volatile uint32_t nOverflowCount;        // 边沿环形缓冲区溢出次数
+
+    // 解码器：最近匹配的协议（移到最前），以及解码开销统计
+    uint8_t recentProtocols[RCSWITCH_RECENT_PROTOCOLS];
+    bool bProtocolIndexEnabled;              // 是否按候选索引筛选协议
+    uint32_t nDecodedFrames;
+    uint32_t nDecodeAttempts;
+    uint32_t nDecodeMicros;
+
+    #if defined(ESP32)
+    static TaskHandle_t notifyTask;           // 帧完整时由ISR通知的解码任务
+    #endif
     #endif
 
     
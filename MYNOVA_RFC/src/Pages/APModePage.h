@@ -22,6 +22,7 @@ enum APModePageState {
 class APModePage : public UIPage {
 public:
     APModePage();
+    const char* getPageName() override { return "APModePage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -218,8 +218,6 @@ void ArkanoidPage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    u8g2->sendBuffer();
 }
 
 void ArkanoidPage::update() {
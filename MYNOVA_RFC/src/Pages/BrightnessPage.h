@@ -17,6 +17,7 @@
 class BrightnessPage : public UIPage {
 public:
     BrightnessPage();
+    const char* getPageName() override { return "BrightnessPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -17,6 +17,7 @@ EditDataPage::EditDataPage(int dataIndex, bool isNew) : UIPage(0, 0, SCREEN_WIDT
     isNewData(isNew),
     currentState(EDIT_FIELDS),
     currentFieldIndex(FIELD_FREQ),
+    saveJobId(0),
     currentFreqIndex(0),
     currentProtocolIndex(0),
     currentBitLengthIndex(0) {
@@ -218,7 +219,7 @@ void EditDataPage::initLayout() {
     // 名称输入框
     nameInput = new UIInput(0, 0, 128, 50);
     nameInput->setTitle("请输入名称");
-    nameInput->setText(currentData.name);
+    nameInput->setText(currentData.name.c_str());
     nameInput->setTextAlign(INPUT_LEFT);
     nameInput->bVisible = false;
     addWidget(nameInput);
@@ -356,7 +357,8 @@ void EditDataPage::switchToNameEdit() {
     
     // 显示名称编辑UI
     nameInput->bVisible = true;
-    nameInput->setText(currentData.name);
+    nameInput->setTitle("请输入名称");
+    nameInput->setText(currentData.name.c_str());
     nameNavBar->bVisible = true;
 }
 
@@ -364,11 +366,9 @@ void EditDataPage::saveAndReturn() {
     // 保存名称
     currentData.name = nameInput->getText();
     
-    // 保存到存储
-    dataStore.SaveData(dataIndex, currentData);
-    
-    // 返回上一页
-    uiEngine.navigateBack();
+    // 写入Flash交给主循环，成功后在 update() 中返回上一页
+    saveJobId = dataStore.SaveDataAsync(dataIndex, currentData);
+    nameInput->setTitle(saveJobId != 0 ? "正在保存..." : "保存失败，请重试");
 }
 
 String EditDataPage::generateDefaultName() {
@@ -384,6 +384,25 @@ void EditDataPage::update() {
     if (currentState == EDIT_NAME) {
         nameInput->update();
     }
+
+    // 取回保存结果：成功返回上一页，失败时留在名称输入界面，可以重试
+    if (saveJobId != 0) {
+        const StoreJobState state = dataStore.GetJobState(saveJobId);
+        if (state == STORE_JOB_DONE) {
+            saveJobId = 0;
+            uiEngine.navigateBack();
+        } else if (state == STORE_JOB_FAILED) {
+            saveJobId = 0;
+            nameInput->setTitle("保存失败，请重试");
+        }
+    }
+}
+
+uint32_t EditDataPage::getRefreshInterval() {
+    if (saveJobId != 0) {
+        return 0;
+    }
+    return UIPage::getRefreshInterval();
 }
 
 void EditDataPage::onButtonBack(void* context) {
@@ -419,7 +438,7 @@ void EditDataPage::onButtonEnter(void* context) {
         navBar->showRightBlink(1, 80, 80, [this]() {
             switchToNameEdit();
         });
-    } else if (currentState == EDIT_NAME) {
+    } else if (currentState == EDIT_NAME && saveJobId == 0) {
         nameNavBar->showRightBlink(1, 80, 80, [this]() {
             saveAndReturn();
         });
@@ -25,9 +25,11 @@ public:
     // dataIndex: 数据位置索引(1-100)，isNew: 是否是新建
     EditDataPage(int dataIndex, bool isNew);
     ~EditDataPage();
+    const char* getPageName() override { return "EditDataPage"; }
     
     void render(U8G2* u8g2) override;
     void update() override;
+    uint32_t getRefreshInterval() override;  // 等待保存结果期间按帧连续刷新
     
     // 按钮事件处理
     void onButtonBack(void* context) override;
@@ -71,6 +73,7 @@ private:
     RadioData currentData;
     EditState currentState;
     int currentFieldIndex;  // 当前选中的字段索引
+    uint32_t saveJobId;     // 等待结果的异步保存任务，0表示没有
     
     // UI组件 - 字段编辑状态
     UILabel* statusLabel;           // 顶部状态标签
@@ -8,13 +8,16 @@
 #include "FactoryResetPage.h"
 #include "../GUI/UIEngine.h"
 #include "../DataStore.h"
+#include "../SystemSetting.h"
 #include <ESP.h>
 
 extern UIEngine uiEngine;
 extern DataStore dataStore;
+extern SystemSetting systemSetting;
 
 FactoryResetPage::FactoryResetPage() : UIPage(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT) {
     currentState = STATE_CONFIRM;
+    resetJobId = 0;
     initLayout();
 }
 
@@ -124,17 +127,49 @@ void FactoryResetPage::updateDisplay() {
         yesInput->bVisible = true;
         inputNavBar->bVisible = true;
     }
+    else if (currentState == STATE_RESETTING) {
+        // 只显示进度提示，按键不再响应
+        yesInput->bVisible = false;
+        inputNavBar->bVisible = false;
+    }
 }
 
 void FactoryResetPage::performFactoryReset() {
-    // 清空所有数据
-    dataStore.ClearAllData();
-    
-    // 延迟一下确保数据写入完成
-    delay(500);
+    // 丢弃待保存的配置，避免清空后又被主循环写回
+    systemSetting.discardPendingSave();
     
-    // 重启系统
-    ESP.restart();
+    // 清空所有数据：写入Flash交给主循环，完成后在 update() 中重启
+    resetJobId = dataStore.ClearAllDataAsync();
+    if (resetJobId == 0) {
+        inputPromptLabel->label = "恢复失败，请重试";
+        return;
+    }
+    inputPromptLabel->label = "正在恢复...";
+    currentState = STATE_RESETTING;
+    updateDisplay();
+}
+
+void FactoryResetPage::update() {
+    if (currentState != STATE_RESETTING) {
+        return;
+    }
+    const StoreJobState state = dataStore.GetJobState(resetJobId);
+    if (state == STORE_JOB_DONE) {
+        // 重启系统
+        ESP.restart();
+    } else if (state == STORE_JOB_FAILED) {
+        resetJobId = 0;
+        inputPromptLabel->label = "恢复失败，请重试";
+        currentState = STATE_INPUT_YES;
+        updateDisplay();
+    }
+}
+
+uint32_t FactoryResetPage::getRefreshInterval() {
+    if (currentState == STATE_RESETTING) {
+        return 0;
+    }
+    return UIPage::getRefreshInterval();
 }
 
 void FactoryResetPage::onButtonBack(void* context) {
@@ -16,12 +16,16 @@
 
 enum FactoryResetPageState {
     STATE_CONFIRM,      // 确认状态
-    STATE_INPUT_YES     // 输入YES确认状态
+    STATE_INPUT_YES,    // 输入YES确认状态
+    STATE_RESETTING     // 正在清空数据，完成后重启
 };
 
 class FactoryResetPage : public UIPage {
 public:
     FactoryResetPage();
+    const char* getPageName() override { return "FactoryResetPage"; }
+    void update() override;
+    uint32_t getRefreshInterval() override;  // 等待清空结果期间按帧连续刷新
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -53,6 +57,7 @@ private:
     UINavBar* inputNavBar;     // 输入状态下的导航栏
     
     FactoryResetPageState currentState; // 当前页面状态
+    uint32_t resetJobId;                // 异步清空任务，0表示没有
 };
 
 #endif
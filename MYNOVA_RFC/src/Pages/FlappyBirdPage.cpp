@@ -97,9 +97,6 @@ void FlappyBirdPage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    // 更新屏幕
-    u8g2->sendBuffer();
 }
 
 void FlappyBirdPage::update() {
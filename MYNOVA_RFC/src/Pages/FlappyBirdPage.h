@@ -16,6 +16,7 @@ class FlappyBirdPage : public UIPage {
 public:
     FlappyBirdPage();
     ~FlappyBirdPage();  // 析构函数，用于恢复普通按键模式
+    const char* getPageName() override { return "FlappyBirdPage"; }
     
     // 重写页面显示函数，启用快速响应模式
     void showPage() override;
@@ -23,6 +24,7 @@ public:
     // 重写渲染和更新函数
     void render(U8G2* u8g2) override;
     void update() override;
+    uint32_t getRefreshInterval() override { return 0; }  // 游戏按帧连续渲染
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -15,6 +15,7 @@
 class GameListPage : public UIPage {
 public:
     GameListPage();
+    const char* getPageName() override { return "GameListPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
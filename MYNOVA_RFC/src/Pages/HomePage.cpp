@@ -114,6 +114,13 @@ void HomePage::initLayout() {
     addWidget(&quickButtons[8]);
 }
 
+uint32_t HomePage::getRefreshInterval() {
+    if (titleBar.isAnimating()) {
+        return 0;
+    }
+    return UIPage::getRefreshInterval();
+}
+
 void HomePage::updateStatus() {
     // 从 Flash 加载快捷键数据到缓存
     loadQuickKeyData();
@@ -151,16 +158,15 @@ void HomePage::loadQuickKeyData() {
     // 加载数据并更新按钮标签
     for (int i = 0; i < 9; i++) {
         if (keyIndices[i] > 0) {
-            cachedRadioData[i] = dataStore.ReadData(keyIndices[i]);
-            if (cachedRadioData[i].name.length() > 0) {
-                quickButtons[i].label = cachedRadioData[i].name;
+            if (dataStore.ReadData(keyIndices[i], cachedRadioData[i])) {
+                quickButtons[i].label = cachedRadioData[i].name.c_str();
             } else {
                 quickButtons[i].label = "----------";
-                cachedRadioData[i].name = "";  // 清空无效数据
+                cachedRadioData[i].name.clear();  // 清空无效数据
             }
         } else {
             quickButtons[i].label = "----------";
-            cachedRadioData[i].name = "";  // 标记为空
+            cachedRadioData[i].name.clear();  // 标记为空
         }
     }
     
@@ -184,7 +190,10 @@ bool HomePage::sendCachedData(int buttonIndex) {
     // 直接使用缓存的数据
     if (cachedRadioData[buttonIndex].name.length() > 0) {
         lastSendTime = currentTime;  // 更新上次发送时间
-        radioHelper.SendData(cachedRadioData[buttonIndex].rcData);
+        // 只放入发送队列，由射频发送任务发出，不阻塞渲染任务
+        if (!radioHelper.SendData(cachedRadioData[buttonIndex].rcData)) {
+            return false;
+        }
         // 显示发送动画
         titleBar.showSendAnime();
         return true;
@@ -18,6 +18,7 @@
 class HomePage : public UIPage {
 public:
     HomePage();
+    const char* getPageName() override { return "HomePage"; }
     
     // 重写按钮事件处理
     void onButtonMenu(void* context = nullptr) override;
@@ -32,6 +33,7 @@ public:
     void onButton9(void* context = nullptr) override;
     
     void showPage() override;
+    uint32_t getRefreshInterval() override;  // 标题栏收发动画期间按帧连续刷新
 
     void setBattery(float voltage);
     void updateStatus();
@@ -17,7 +17,8 @@ extern DataStore dataStore;
 ManageDataPage::ManageDataPage() : UIPage(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
     currentState(STATE_SELECT_DATA),
     selectedDataIndex(0),
-    hasData(false) {
+    hasData(false),
+    deleteJobId(0) {
     initLayout();
 }
 
@@ -36,17 +37,10 @@ void ManageDataPage::initLayout() {
     dataListMenu->getNavBar()->setLeftButtonText("返回");
     dataListMenu->getNavBar()->setRightButtonText("选择");
     
-    // 加载所有数据位置
-    for (int i = 1; i <= 100; i++) {
-        String itemName = String(i) + ". ";
-        RadioData data = dataStore.ReadData(i);
-        if (data.name.length() > 0) {
-            itemName += data.name;
-        } else {
-            itemName += "----------";
-        }
-        dataListMenu->addMenuItem(itemName);
-    }
+    // 菜单行在显示时按需读取，打开页面时不遍历整个码库
+    dataListMenu->setItemProvider(
+        []() { return RADIO_DATA_SLOT_COUNT; },
+        [](int index, char* buffer, size_t size) { dataStore.FormatSlotListItem(index, buffer, size); });
     addWidget(dataListMenu);
     
     // 初始化操作菜单
@@ -115,10 +109,11 @@ void ManageDataPage::deleteData() {
     emptyData.rcData.pulseLength = 0;
     emptyData.rcData.freqType = FREQ_315;
     
-    dataStore.SaveData(selectedDataIndex, emptyData);
-    
-    // 刷新数据列表
-    refreshDataList();
+    // 写入Flash交给主循环，完成后在 update() 中刷新数据列表
+    deleteJobId = dataStore.SaveDataAsync(selectedDataIndex, emptyData);
+    if (deleteJobId == 0) {
+        Serial.println("ManageDataPage: 删除数据失败");
+    }
     
     // 隐藏确认框
     deleteConfirmBox->hide();
@@ -142,23 +137,8 @@ void ManageDataPage::createNewData() {
 }
 
 void ManageDataPage::refreshDataList() {
-    // 清空并重新加载数据列表
-    // 删除所有现有菜单项
-    for (int i = 99; i >= 0; i--) {
-        dataListMenu->removeMenuItem(i);
-    }
-    
-    // 重新加载所有数据
-    for (int i = 1; i <= 100; i++) {
-        String itemName = String(i) + ". ";
-        RadioData data = dataStore.ReadData(i);
-        if (data.name.length() > 0) {
-            itemName += data.name;
-        } else {
-            itemName += "----------";
-        }
-        dataListMenu->addMenuItem(itemName);
-    }
+    // 数据已修改或删除，丢弃已生成的菜单行，下次显示时重新读取
+    dataListMenu->invalidateItems();
 }
 
 void ManageDataPage::render(U8G2* u8g2) {
@@ -168,6 +148,25 @@ void ManageDataPage::render(U8G2* u8g2) {
 
 void ManageDataPage::update() {
     deleteConfirmBox->update();
+
+    if (deleteJobId != 0) {
+        const StoreJobState state = dataStore.GetJobState(deleteJobId);
+        if (state != STORE_JOB_PENDING) {
+            // 删除失败时数据仍保留在列表中
+            if (state == STORE_JOB_FAILED) {
+                Serial.println("ManageDataPage: 删除数据失败");
+            }
+            deleteJobId = 0;
+            refreshDataList();
+        }
+    }
+}
+
+uint32_t ManageDataPage::getRefreshInterval() {
+    if (deleteJobId != 0) {
+        return 0;
+    }
+    return UIPage::getRefreshInterval();
 }
 
 void ManageDataPage::showPage() {
@@ -20,9 +20,11 @@ class ManageDataPage : public UIPage {
 public:
     ManageDataPage();
     ~ManageDataPage();
+    const char* getPageName() override { return "ManageDataPage"; }
     
     void render(U8G2* u8g2) override;
     void update();
+    uint32_t getRefreshInterval() override;  // 等待删除结果期间按帧连续刷新
     void showPage() override;  // 页面显示时刷新数据
     
     // 按钮事件处理
@@ -57,6 +59,7 @@ private:
     ManageState currentState;
     int selectedDataIndex;  // 当前选择的数据索引(1-100)
     bool hasData;           // 当前选择的位置是否有数据
+    uint32_t deleteJobId;   // 等待结果的异步删除任务，0表示没有
     
     // UI组件
     UIMenu* dataListMenu;       // 数据列表菜单
@@ -16,6 +16,7 @@
 class MenuPage : public UIPage {
 public:
     MenuPage();
+    const char* getPageName() override { return "MenuPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
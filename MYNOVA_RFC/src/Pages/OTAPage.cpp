@@ -8,10 +8,12 @@
 #include "../GUI/UIEngine.h"
 #include "../WiFiManager.h"
 #include "../GUIRender.h"
+#include "../SystemSetting.h"
 #include "../../Version.h"
 
 extern UIEngine uiEngine;
 extern WiFiManager wifiManager; // 假设有全局实例
+extern SystemSetting systemSetting;
 
 // 替换为你的域名 Please replace with your domain
 #define UPDATE_JSON_URL "https://mydomain.com/rfc/update.json" 
@@ -347,6 +349,8 @@ void OTAPage::onButtonEnter(void* context) {
         });
     } else if (currentState == OTA_STATE_DONE) {
         navBar->showRightBlink(1, 80, 80, [this]() {
+            // 重启前写入待保存的配置
+            systemSetting.saveConfig();
             ESP.restart();
         });
     }
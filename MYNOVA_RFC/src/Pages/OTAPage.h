@@ -28,6 +28,7 @@ enum OTAState {
 class OTAPage : public UIPage {
 public:
     OTAPage();
+    const char* getPageName() override { return "OTAPage"; }
     virtual ~OTAPage();
     
     void update() override;
@@ -17,6 +17,7 @@
 class PowerSavePage : public UIPage {
 public:
     PowerSavePage();
+    const char* getPageName() override { return "PowerSavePage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
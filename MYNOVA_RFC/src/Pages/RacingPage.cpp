@@ -106,8 +106,6 @@ void RacingPage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    u8g2->sendBuffer();
 }
 
 void RacingPage::update() {
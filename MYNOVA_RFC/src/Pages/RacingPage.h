@@ -22,10 +22,12 @@ class RacingPage : public UIPage {
 public:
     RacingPage();
     ~RacingPage();
+    const char* getPageName() override { return "RacingPage"; }
     
     void showPage() override;
     void render(U8G2* u8g2) override;
     void update() override;
+    uint32_t getRefreshInterval() override { return 0; }  // 游戏按帧连续渲染
     
     // 按钮事件
     void onButtonBack(void* context = nullptr) override;
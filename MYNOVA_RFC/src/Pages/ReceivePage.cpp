@@ -9,9 +9,11 @@
 #include "../GUI/UIEngine.h"
 #include "../GUIRender.h"
 #include "SaveDataPage.h"
+#include "../DataStore.h"
 
 extern UIEngine uiEngine;
 extern RadioHelper radioHelper;
+extern DataStore dataStore;
 extern GUIRender guiRender;
 
 ReceivePage::ReceivePage() : UIPage(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
@@ -21,7 +23,9 @@ ReceivePage::ReceivePage() : UIPage(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
     bitLengthLabel(nullptr),
     protocolLabel(nullptr),
     currentState(STATE_RECEIVING),
-    lastCheckTime(0) {
+    lastCheckTime(0),
+    frameCursor(0) {
+    memset(&receivedData, 0, sizeof(receivedData));
     initLayout();
 }
 
@@ -130,12 +134,23 @@ void ReceivePage::startReceiving() {
     pulseLengthLabel->label = "脉宽: --";
     navBar->setRightButtonText("");
     
+    // 只关注启动之后收到的帧
+    frameCursor = radioHelper.GetFrameSequence();
+    
     // 启动接收（同时支持315和433）
     radioHelper.EnableRecive();
     
     lastCheckTime = millis();
 }
 
+// 接收状态在 render 中每100ms检查一次，接收期间按该间隔刷新
+uint32_t ReceivePage::getRefreshInterval() {
+    if (currentState == STATE_RECEIVING) {
+        return 100;
+    }
+    return UIPage::getRefreshInterval();
+}
+
 void ReceivePage::stopReceiving() {
     // 只有在接收模式下才禁用接收
     if (currentState == STATE_RECEIVING) {
@@ -172,28 +187,38 @@ void ReceivePage::updateReceiveStatus() {
     if (currentTime - lastCheckTime > 100) { // 每100ms检查一次
         lastCheckTime = currentTime;
         
-        // 检查是否接收到数据
-        if (radioHelper.rcData.data != 0) {
+        // 从接收帧队列读取新帧
+        RadioFrame frame;
+        if (radioHelper.ReadFrame(frameCursor, frame)) {
             // 接收到数据
+            receivedData = frame.rcData;
             currentState = STATE_RECEIVED;
             statusLabel->label = "接收成功!";
             
+            // 已保存过的编码直接提示对应名称
+            int savedIndex = dataStore.FindSlotByCode(receivedData);
+            if (savedIndex > 0) {
+                RadioData savedData;
+                dataStore.ReadData(savedIndex, savedData);
+                statusLabel->label = String("已保存为: ") + savedData.name.c_str();
+            }
+            
             // 更新频率显示（根据实际接收到的频率）
-            if (radioHelper.rcData.freqType == FREQ_315) {
+            if (receivedData.freqType == FREQ_315) {
                 freqLabel->label = "频率: 315MHz";
             } else {
                 freqLabel->label = "频率: 433MHz";
             }
             
             // 更新数据显示（如果数据太长，进行截断）
-            String dataStr = formatHexData(radioHelper.rcData.data);
+            String dataStr = formatHexData(receivedData.data);
             if (dataStr.length() > 10) {
                 dataStr = dataStr.substring(0, 10) + "...";
             }
             dataLabel->label = "数据: " + dataStr;
-            bitLengthLabel->label = "位长: " + String(radioHelper.rcData.bitLength) + "bit";
-            protocolLabel->label = "协议: " + String(radioHelper.rcData.protocal);
-            pulseLengthLabel->label = "脉宽: " + String(radioHelper.rcData.pulseLength);
+            bitLengthLabel->label = "位长: " + String(receivedData.bitLength) + "bit";
+            protocolLabel->label = "协议: " + String(receivedData.protocal);
+            pulseLengthLabel->label = "脉宽: " + String(receivedData.pulseLength);
             navBar->setRightButtonText("保存");
 
             // 停止接收
@@ -242,7 +267,7 @@ void ReceivePage::onButtonEnter(void* context) {
         // 显示右键闪烁动画，动画完成后跳转到保存页面
         navBar->showRightBlink(1, 80, 80, [this]() {
             // 跳转到数据列表页面以保存数据
-            SaveDataPage* saveDataPage = new SaveDataPage(radioHelper.rcData);
+            SaveDataPage* saveDataPage = new SaveDataPage(receivedData);
             uiEngine.navigateTo(saveDataPage);
         });
     }
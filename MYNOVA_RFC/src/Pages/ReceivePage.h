@@ -24,9 +24,11 @@ class ReceivePage : public UIPage {
 public:
     ReceivePage();
     ~ReceivePage();
+    const char* getPageName() override { return "ReceivePage"; }
     
     void render(U8G2* u8g2) override;
     void showPage() override;  // 页面显示时自动开始接收
+    uint32_t getRefreshInterval() override;  // 接收中按轮询间隔刷新
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
     void onButtonEnter(void* context = nullptr) override;
@@ -49,6 +51,8 @@ private:
     
     ReceivePageState currentState;  // 当前页面状态
     unsigned long lastCheckTime;    // 上次检查时间
+    uint32_t frameCursor;           // 接收帧队列读取游标
+    RCData receivedData;            // 接收到的数据
 };
 
 #endif
\ No newline at end of file
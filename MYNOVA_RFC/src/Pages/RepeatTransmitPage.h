@@ -17,6 +17,7 @@
 class RepeatTransmitPage : public UIPage {
 public:
     RepeatTransmitPage();
+    const char* getPageName() override { return "RepeatTransmitPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
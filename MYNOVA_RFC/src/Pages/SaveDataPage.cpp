@@ -15,7 +15,8 @@ extern UIEngine uiEngine;
 extern DataStore dataStore;
 SaveDataPage::SaveDataPage(RCData rcData) : UIPage(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
 receivedData(rcData),
-currentState(STATE_SELECT) {
+currentState(STATE_SELECT),
+saveJobId(0) {
     initLayout();
 }
 
@@ -33,16 +34,10 @@ void SaveDataPage::initLayout() {
     // 通过导航栏设置按钮文字
     dataListMenu->getNavBar()->setLeftButtonText("返回");
     dataListMenu->getNavBar()->setRightButtonText("选择");
-    for (int i = 1; i <= 100; i++) {
-        String itemName = String(i) + ". ";
-        RadioData data = dataStore.ReadData(i);
-        if (data.name.length() > 0) {
-            itemName += data.name;
-        } else {
-            itemName += "----------";
-        }
-        dataListMenu->addMenuItem(itemName);
-    }
+    // 菜单行在显示时按需读取，打开页面时不遍历整个码库
+    dataListMenu->setItemProvider(
+        []() { return RADIO_DATA_SLOT_COUNT; },
+        [](int index, char* buffer, size_t size) { dataStore.FormatSlotListItem(index, buffer, size); });
     addWidget(dataListMenu);
 
     // 初始化提示框（使用默认居中位置，避开底部NavBar）
@@ -80,21 +75,26 @@ void SaveDataPage::render(U8G2* u8g2) {
     UIPage::render(u8g2);
 }
 
-// void SaveDataPage::update() {
-//     // // 更新动画引擎
-//     // animationEngine.update();
-    
-//     // // 更新消息框（处理自动关闭）
-//     // messageBox->update();
-    
-//     if (currentState == STATE_INPUTNAME) {
-//         nameInput->update();
-//     }
-    
-//     if (currentState == STATE_SAVE_SUCCESS) {
-//         successMessageBox->update();
-//     }
-// }
+// 保存在主循环中完成，这里取回结果更新提示
+void SaveDataPage::update() {
+    if (saveJobId == 0) {
+        return;
+    }
+    const StoreJobState state = dataStore.GetJobState(saveJobId);
+    if (state == STORE_JOB_PENDING) {
+        return;
+    }
+    saveJobId = 0;
+    dataListMenu->invalidateItems();
+    successMessageBox->setMessage(state == STORE_JOB_DONE ? "保存成功！" : "保存失败！");
+}
+
+uint32_t SaveDataPage::getRefreshInterval() {
+    if (saveJobId != 0) {
+        return 0;
+    }
+    return UIPage::getRefreshInterval();
+}
 
 void SaveDataPage::onButtonBack(void* context) {
     if(currentState == STATE_SELECT)
@@ -168,7 +168,7 @@ void SaveDataPage::onButtonEnter(void* context) {
             RadioData data = dataStore.ReadData(selectedIndex);
             inputNavBar->bVisible = true;
             nameInput->bVisible = true;
-            nameInput->setText(data.name);
+            nameInput->setText(data.name.c_str());
             currentState = STATE_INPUTNAME;
         });
     }else if(currentState == STATE_INPUTNAME)
@@ -257,13 +257,15 @@ void SaveDataPage::saveDataAndReturn() {
     RadioData radioData;
     radioData.rcData = receivedData;
     radioData.name = nameInput->getText();
-    dataStore.SaveData(selectedIndex, radioData);
+    // 写入Flash交给主循环，不阻塞渲染任务
+    saveJobId = dataStore.SaveDataAsync(selectedIndex, radioData);
     
     // 隐藏输入框和导航栏
     nameInput->bVisible = false;
     inputNavBar->bVisible = false;
     
-    // 显示保存成功提示
+    // 显示保存结果提示，结果在 update() 中取回
+    successMessageBox->setMessage(saveJobId != 0 ? "正在保存..." : "保存失败！");
     successMessageBox->show(MSGBOX_ANIME_ZOOM_CENTER, 300);
     currentState = STATE_SAVE_SUCCESS;
 }
\ No newline at end of file
@@ -28,9 +28,12 @@ class SaveDataPage : public UIPage {
 public:
     SaveDataPage(RCData rcData);
     ~SaveDataPage();
+    const char* getPageName() override { return "SaveDataPage"; }
     
     void initLayout();
     void render(U8G2* u8g2) override;
+    void update() override;
+    uint32_t getRefreshInterval() override;  // 等待保存结果期间按帧连续刷新
     void onButtonBack(void* context) override;
     void onButtonEnter(void* context) override;
     void onButtonMenu(void* context) override;
@@ -52,6 +55,7 @@ private:
     UINavBar* inputNavBar;
     RCData receivedData;
     SaveDataPageState currentState;  // 当前页面状态
+    uint32_t saveJobId;              // 等待结果的异步保存任务，0表示没有
     String generateDefaultName(int index);
     void saveDataAndReturn();
 };
@@ -38,16 +38,10 @@ void SendDataPage::initLayout() {
     dataListMenu->getNavBar()->setLeftButtonText("返回");
     dataListMenu->getNavBar()->setRightButtonText("选择");
     
-    for (int i = 1; i <= 100; i++) {
-        String itemName = String(i) + ". ";
-        RadioData data = dataStore.ReadData(i);
-        if (data.name.length() > 0) {
-            itemName += data.name;
-        } else {
-            itemName += "----------";
-        }
-        dataListMenu->addMenuItem(itemName);
-    }
+    // 菜单行在显示时按需读取，打开页面时不遍历整个码库
+    dataListMenu->setItemProvider(
+        []() { return RADIO_DATA_SLOT_COUNT; },
+        [](int index, char* buffer, size_t size) { dataStore.FormatSlotListItem(index, buffer, size); });
     addWidget(dataListMenu);
 
     // 初始化详情页面的标签
@@ -173,7 +167,7 @@ void SendDataPage::showDataDetail(int index) {
         currentData = data;
         
         // 显示详情信息
-        nameLabel->label = "名称: " + data.name;
+        nameLabel->label = String("名称: ") + data.name.c_str();
         nameLabel->bVisible = true;
         
         if (data.rcData.freqType == FREQ_315) {
@@ -27,6 +27,7 @@ class SendDataPage : public UIPage {
 public:
     SendDataPage();
     ~SendDataPage();
+    const char* getPageName() override { return "SendDataPage"; }
     
     void initLayout();
     void render(U8G2* u8g2) override;
@@ -15,6 +15,7 @@
 class SettingPage : public UIPage {
 public:
     SettingPage();
+    const char* getPageName() override { return "SettingPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
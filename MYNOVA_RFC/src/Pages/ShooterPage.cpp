@@ -138,8 +138,6 @@ void ShooterPage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    u8g2->sendBuffer();
 }
 
 void ShooterPage::update() {
@@ -111,8 +111,6 @@ void SnakePage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    u8g2->sendBuffer();
 }
 
 void SnakePage::update() {
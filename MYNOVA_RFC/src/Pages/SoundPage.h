@@ -17,6 +17,7 @@
 class SoundPage : public UIPage {
 public:
     SoundPage();
+    const char* getPageName() override { return "SoundPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
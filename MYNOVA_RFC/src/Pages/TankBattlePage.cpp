@@ -182,8 +182,6 @@ void TankBattlePage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    u8g2->sendBuffer();
 }
 
 void TankBattlePage::update() {
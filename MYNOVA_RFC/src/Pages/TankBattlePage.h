@@ -36,6 +36,7 @@ class TankBattlePage : public UIPage {
 public:
     TankBattlePage();
     ~TankBattlePage();
+    const char* getPageName() override { return "TankBattlePage"; }
     
     // 重写页面显示函数
     void showPage() override;
@@ -43,6 +44,7 @@ public:
     // 重写渲染和更新函数
     void render(U8G2* u8g2) override;
     void update() override;
+    uint32_t getRefreshInterval() override { return 0; }  // 游戏按帧连续渲染
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -134,8 +134,6 @@ void TetrisPage::render(U8G2* u8g2) {
             drawGameOverScreen(u8g2);
             break;
     }
-    
-    u8g2->sendBuffer();
 }
 
 void TetrisPage::update() {
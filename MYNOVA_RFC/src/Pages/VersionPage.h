@@ -16,6 +16,7 @@
 class VersionPage : public UIPage {
 public:
     VersionPage();
+    const char* getPageName() override { return "VersionPage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -17,6 +17,7 @@
 class WiFiModePage : public UIPage {
 public:
     WiFiModePage();
+    const char* getPageName() override { return "WiFiModePage"; }
     
     // 重写按钮事件处理
     void onButtonBack(void* context = nullptr) override;
@@ -0,0 +1,215 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "RadioBenchmark.h"
+#include "Lib/RCSwitch.h"
+#include "Lib/PulseTrain.h"
+
+// 编码实例只用于渲染脉冲序列，解码实例只用于回放；两者都不挂接引脚。
+// 放在静态区，避免在Web请求线程的栈上分配数KB的接收缓冲区。
+static RCSwitch encoder;
+static RCSwitch decoder;
+static PulseTrain train;
+
+RadioBenchmark::RadioBenchmark()
+{
+    randomState = 1;
+}
+
+BenchmarkConfig RadioBenchmark::DefaultConfig()
+{
+    BenchmarkConfig config;
+    config.framesPerProtocol = 50;
+    config.bitLength = 24;
+    config.jitter = 0;
+    config.noise = 0;
+    config.noiseFrames = 200;
+    config.seed = 1;
+    config.protocolIndex = true;
+    return config;
+}
+
+// xorshift32：固定种子即可得到完全相同的帧序列，便于前后版本对比
+uint32_t RadioBenchmark::nextRandom()
+{
+    uint32_t x = randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+    return x;
+}
+
+unsigned int RadioBenchmark::randomRange(unsigned int lo, unsigned int hi)
+{
+    if (hi <= lo) {
+        return lo;
+    }
+    return lo + nextRandom() % (hi - lo + 1);
+}
+
+// 按接收中断看到的样子合成一帧：timings[0]为同步间隔（最长的那段电平），
+// 之后依次是下一帧的各段电平，直到再次遇到同步间隔为止。
+unsigned int RadioBenchmark::synthesizeFrame(unsigned int protocol, unsigned long code, const BenchmarkConfig& config, unsigned int* timings)
+{
+    encoder.setProtocol(protocol);
+    if (!encoder.renderPulseTrain(code, config.bitLength, train)) {
+        return 0;
+    }
+
+    // 合并被拆分的同电平长段，得到真实的电平持续时间
+    unsigned int runs[RCSWITCH_MAX_CHANGES];
+    unsigned int count = 0;
+    int lastLevel = -1;
+    for (uint16_t i = 0; i < train.size(); i++) {
+        const int level = train.levelAt(i);
+        if (level == lastLevel && count > 0) {
+            runs[count - 1] += train.durationAt(i);
+            continue;
+        }
+        if (count >= RCSWITCH_MAX_CHANGES) {
+            return 0;
+        }
+        runs[count++] = train.durationAt(i);
+        lastLevel = level;
+    }
+
+    unsigned int sync = 0;
+    for (unsigned int i = 1; i < count; i++) {
+        if (runs[i] > runs[sync]) {
+            sync = i;
+        }
+    }
+
+    for (unsigned int i = 0; i < count; i++) {
+        int t = runs[(sync + i) % count];
+        if (config.jitter > 0) {
+            t += (int)randomRange(0, config.jitter * 2) - (int)config.jitter;
+        }
+        if (config.noise > 0 && i > 0 && randomRange(1, 100) <= config.noise) {
+            t = randomRange(20, 200);   // 短毛刺替换原有电平
+        }
+        timings[i] = (t > 1) ? t : 1;
+    }
+    return count;
+}
+
+// 纯噪声帧：同步间隔之后跟随随机长度、随机宽度的电平
+unsigned int RadioBenchmark::synthesizeNoise(unsigned int* timings)
+{
+    const unsigned int count = randomRange(8, RCSWITCH_MAX_CHANGES);
+    timings[0] = randomRange(4300, 20000);
+    for (unsigned int i = 1; i < count; i++) {
+        timings[i] = randomRange(100, 2000);
+    }
+    return count;
+}
+
+void RadioBenchmark::Run(const BenchmarkConfig& config, JsonDocument& result)
+{
+    BenchmarkConfig cfg = config;
+    cfg.framesPerProtocol = constrain(config.framesPerProtocol, 1u, (unsigned int)BENCHMARK_MAX_FRAMES);
+    cfg.bitLength = constrain(config.bitLength, 4u, 32u);
+    cfg.jitter = (config.jitter > 1000) ? 1000 : config.jitter;
+    cfg.noise = (config.noise > 100) ? 100 : config.noise;
+    cfg.noiseFrames = (config.noiseFrames > BENCHMARK_MAX_FRAMES * 10) ? BENCHMARK_MAX_FRAMES * 10 : config.noiseFrames;
+    const unsigned int frames = cfg.framesPerProtocol;
+
+    randomState = cfg.seed ? cfg.seed : 1;
+    // 只切换基准测试自己的解码实例，接收任务中的解码器不受影响
+    decoder.setProtocolIndexEnabled(cfg.protocolIndex);
+    decoder.resetDecodeStats();
+
+    const uint32_t cpuMHz = getCpuFrequencyMhz();
+    const unsigned long codeMask = (cfg.bitLength >= 32) ? 0xFFFFFFFFUL : ((1UL << cfg.bitLength) - 1);
+    unsigned int timings[RCSWITCH_MAX_CHANGES];
+    uint64_t totalCycles = 0;
+    uint32_t totalFrames = 0;
+
+    JsonArray protocols = result["protocols"].to<JsonArray>();
+    for (unsigned int p = 1; p <= RCSwitch::getProtocolCount(); p++) {
+        uint32_t correct = 0, falseNegative = 0, falsePositive = 0;
+        uint64_t cycles = 0;
+
+        for (unsigned int n = 0; n < frames; n++) {
+            unsigned long code = nextRandom() & codeMask;
+            if (code == 0) {
+                code = 1;
+            }
+            const unsigned int changeCount = synthesizeFrame(p, code, cfg, timings);
+
+            // 只统计解码本身的耗时，合成帧不计入
+            const uint32_t start = ESP.getCycleCount();
+            const bool decoded = decoder.decodeCapture(timings, changeCount);
+            cycles += (uint32_t)(ESP.getCycleCount() - start);
+
+            if (!decoded || !decoder.available()) {
+                falseNegative++;
+            } else if (decoder.getReceivedValue() == code && decoder.getReceivedBitlength() == cfg.bitLength) {
+                correct++;
+            } else {
+                falsePositive++;
+            }
+            decoder.resetAvailable();
+        }
+
+        JsonObject item = protocols.add<JsonObject>();
+        item["protocol"] = p;
+        item["frames"] = frames;
+        item["correct"] = correct;
+        item["falseNegative"] = falseNegative;
+        item["falsePositive"] = falsePositive;
+        item["fnRate"] = (float)falseNegative / frames;
+        item["fpRate"] = (float)falsePositive / frames;
+        item["nsPerFrame"] = (uint32_t)(cycles * 1000 / cpuMHz / frames);
+
+        totalCycles += cycles;
+        totalFrames += frames;
+        delay(1);   // 让出CPU，避免长时间占用Web线程触发看门狗
+    }
+
+    // 纯噪声帧：任何解码结果都是误报
+    uint32_t noiseDecoded = 0;
+    for (unsigned int n = 0; n < cfg.noiseFrames; n++) {
+        const unsigned int changeCount = synthesizeNoise(timings);
+        const uint32_t start = ESP.getCycleCount();
+        const bool decoded = decoder.decodeCapture(timings, changeCount);
+        totalCycles += (uint32_t)(ESP.getCycleCount() - start);
+        totalFrames++;
+        if (decoded && decoder.available()) {
+            noiseDecoded++;
+        }
+        decoder.resetAvailable();
+    }
+
+    uint32_t statFrames, statAttempts, statMicros;
+    decoder.getDecodeStats(statFrames, statAttempts, statMicros);
+
+    const uint64_t totalNs = totalCycles * 1000 / cpuMHz;
+    JsonObject conf = result["config"].to<JsonObject>();
+    conf["frames"] = cfg.framesPerProtocol;
+    conf["bits"] = cfg.bitLength;
+    conf["jitter"] = cfg.jitter;
+    conf["noise"] = cfg.noise;
+    conf["noiseFrames"] = cfg.noiseFrames;
+    conf["seed"] = cfg.seed;
+    conf["index"] = cfg.protocolIndex;
+
+    JsonObject summary = result["summary"].to<JsonObject>();
+    summary["frames"] = totalFrames;
+    summary["nsPerFrame"] = totalFrames ? (uint32_t)(totalNs / totalFrames) : 0;
+    summary["decodesPerSec"] = totalNs ? (uint32_t)((uint64_t)totalFrames * 1000000000ULL / totalNs) : 0;
+    summary["attemptsPerFrame"] = statFrames ? (float)statAttempts / statFrames : 0;
+    summary["noiseFrames"] = cfg.noiseFrames;
+    summary["noiseFalsePositive"] = noiseDecoded;
+
+    Serial.print("RadioBenchmark frames: ");
+    Serial.print(totalFrames);
+    Serial.print(" ns/frame: ");
+    Serial.print(totalFrames ? (uint32_t)(totalNs / totalFrames) : 0);
+    Serial.print(" noiseFP: ");
+    Serial.println(noiseDecoded);
+}
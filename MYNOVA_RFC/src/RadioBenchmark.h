@@ -0,0 +1,46 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __RADIOBENCHMARK_H__
+#define __RADIOBENCHMARK_H__
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// 每个协议最多回放的帧数（在Web请求线程中同步执行，限制总耗时）
+#define BENCHMARK_MAX_FRAMES 200
+
+struct BenchmarkConfig{
+    unsigned int framesPerProtocol;//每个协议回放的帧数
+    unsigned int bitLength;//合成编码的位长度
+    unsigned int jitter;//每个时隙的随机抖动（±微秒）
+    unsigned int noise;//每个时隙被毛刺替换的概率（百分比）
+    unsigned int noiseFrames;//纯噪声帧数量（统计误报）
+    uint32_t seed;//随机种子，相同种子结果可复现
+    bool protocolIndex;//是否启用协议候选索引
+};
+
+/*
+ * 解码器基准测试：为 proto[] 中每个协议合成时序捕获（可加抖动与噪声），
+ * 回放给独立的解码实例，统计吞吐量以及每个协议的误报/漏报率。
+ * 不需要射频硬件，也不影响正在进行的接收。
+ */
+class RadioBenchmark
+{
+public:
+    RadioBenchmark();
+    static BenchmarkConfig DefaultConfig();
+    void Run(const BenchmarkConfig& config, JsonDocument& result);
+
+private:
+    uint32_t nextRandom();
+    unsigned int randomRange(unsigned int lo, unsigned int hi);
+    unsigned int synthesizeFrame(unsigned int protocol, unsigned long code, const BenchmarkConfig& config, unsigned int* timings);
+    unsigned int synthesizeNoise(unsigned int* timings);
+
+    uint32_t randomState;
+};
+
+#endif
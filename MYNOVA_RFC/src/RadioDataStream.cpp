@@ -0,0 +1,226 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#include "RadioDataStream.h"
+#include <ArduinoJson.h>
+#include "Lib/RCSwitch.h"
+
+// 按JSON字符串规则转义名称，返回写入的字节数（不含结尾0）
+static size_t escapeJson(const char* text, char* out, size_t outSize)
+{
+    size_t n = 0;
+    for (const char* p = text; *p != '\0'; p++) {
+        const uint8_t c = (uint8_t)*p;
+        char escaped[8];
+        size_t escapedLength;
+        if (c == '"' || c == '\\') {
+            escaped[0] = '\\';
+            escaped[1] = (char)c;
+            escapedLength = 2;
+        } else if (c < 0x20) {
+            escapedLength = snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        } else {
+            // UTF-8多字节字符原样输出
+            escaped[0] = (char)c;
+            escapedLength = 1;
+        }
+        if (n + escapedLength >= outSize) {
+            break;
+        }
+        memcpy(out + n, escaped, escapedLength);
+        n += escapedLength;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+RadioDataExporter::RadioDataExporter(DataStore* store):
+pDataStore(store),
+slotCount(0),
+slotPos(0),
+nextIndex(1),
+count(0),
+lineLength(0),
+linePos(0)
+{
+}
+
+int RadioDataExporter::GetCount()
+{
+    return count;
+}
+
+// 取下一个已占用槽位并格式化为一行，没有更多数据返回false
+bool RadioDataExporter::nextLine()
+{
+    while (true) {
+        if (slotPos >= slotCount) {
+            slotCount = pDataStore->GetOccupiedSlots(slots, 32, nextIndex);
+            slotPos = 0;
+            if (slotCount == 0) {
+                return false;
+            }
+            nextIndex = slots[slotCount - 1] + 1;
+        }
+
+        const int index = slots[slotPos++];
+        if (!pDataStore->ReadData(index, radioData)) {
+            // 导出过程中被删除的槽位直接跳过
+            continue;
+        }
+
+        char name[RADIO_NAME_MAX_BYTES * 6 + 1];
+        escapeJson(radioData.name.c_str(), name, sizeof(name));
+        int written = snprintf(line, sizeof(line),
+            "{\"index\":%d,\"name\":\"%s\",\"data\":%lu,\"bitLength\":%u,\"protocol\":%u,\"pulseLength\":%u,\"freqType\":%d}\n",
+            index, name, (unsigned long)radioData.rcData.data, radioData.rcData.bitLength,
+            radioData.rcData.protocal, (unsigned int)radioData.rcData.pulseLength, (int)radioData.rcData.freqType);
+        if (written <= 0 || written >= (int)sizeof(line)) {
+            continue;
+        }
+        lineLength = written;
+        linePos = 0;
+        count++;
+        return true;
+    }
+}
+
+size_t RadioDataExporter::Read(uint8_t* buffer, size_t maxLen)
+{
+    size_t filled = 0;
+    while (filled < maxLen) {
+        if (linePos >= lineLength && !nextLine()) {
+            break;
+        }
+        // 一行放不下时分多次输出，剩余部分留到下一次调用
+        size_t n = lineLength - linePos;
+        if (n > maxLen - filled) {
+            n = maxLen - filled;
+        }
+        memcpy(buffer + filled, line + linePos, n);
+        linePos += n;
+        filled += n;
+    }
+    return filled;
+}
+
+void RadioDataImporter::Begin(DataStore* store, bool replace)
+{
+    pDataStore = store;
+    lineLength = 0;
+    overflow = false;
+    imported = 0;
+    duplicates = 0;
+    failed = 0;
+    pendingClear = replace;
+}
+
+void RadioDataImporter::Write(const uint8_t* data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        const char c = (char)data[i];
+        if (c == '\n') {
+            if (overflow) {
+                failed++;
+            } else {
+                processLine();
+            }
+            lineLength = 0;
+            overflow = false;
+        } else if (!overflow) {
+            if (lineLength < sizeof(line) - 1) {
+                line[lineLength++] = c;
+            } else {
+                overflow = true;
+            }
+        }
+    }
+}
+
+void RadioDataImporter::End()
+{
+    if (overflow) {
+        failed++;
+    } else if (lineLength > 0) {
+        processLine();
+    }
+    lineLength = 0;
+    overflow = false;
+}
+
+void RadioDataImporter::processLine()
+{
+    // 去掉行尾空白（兼容CRLF），跳过空行
+    while (lineLength > 0 && (line[lineLength - 1] == '\r' || line[lineLength - 1] == ' ')) {
+        lineLength--;
+    }
+    if (lineLength == 0) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, line, lineLength)) {
+        failed++;
+        return;
+    }
+
+    // 频段、位长和协议超出范围的记录无法发送，不写入码库
+    const int freqType = doc["freqType"] | -1;
+    const unsigned int bitLength = doc["bitLength"].as<unsigned int>();
+    const unsigned int protocol = doc["protocol"].as<unsigned int>();
+    if ((freqType != FREQ_315 && freqType != FREQ_433) ||
+        bitLength < 1 || bitLength > 32 ||
+        protocol < 1 || protocol > RCSwitch::getProtocolCount()) {
+        failed++;
+        return;
+    }
+
+    RadioData radioData;
+    radioData.name = doc["name"].as<const char*>();
+    radioData.rcData.data = doc["data"].as<unsigned long>();
+    radioData.rcData.bitLength = bitLength;
+    radioData.rcData.protocal = protocol;
+    radioData.rcData.pulseLength = doc["pulseLength"].as<uint16_t>();
+    radioData.rcData.freqType = (FreqType)freqType;
+    if (radioData.name.isEmpty()) {
+        failed++;
+        return;
+    }
+
+    // 覆盖导入：解析出第一条有效记录后才删除全部已有的遥控数据（系统配置不受影响）
+    if (pendingClear) {
+        if (!pDataStore->ClearRadioData()) {
+            failed++;
+            return;
+        }
+        pendingClear = false;
+    }
+
+    // 带槽位编号的记录恢复到原槽位；相同编码已在其他槽位保存时跳过
+    int index = doc["index"] | 0;
+    const int existingIndex = pDataStore->FindSlotByCode(radioData.rcData);
+    if (existingIndex > 0 && existingIndex != index) {
+        duplicates++;
+        return;
+    }
+    // 原槽位已保存了其他编码（合并导入时的已有数据，或文件中重复的槽位编号）时不覆盖，改存到空槽位
+    if (index >= 1 && index <= RADIO_DATA_SLOT_COUNT && existingIndex != index &&
+        pDataStore->IsSlotOccupied(index)) {
+        index = 0;
+    }
+    if (index < 1 || index > RADIO_DATA_SLOT_COUNT) {
+        index = pDataStore->FindFreeSlot();
+        if (index == -1) {
+            failed++;
+            return;
+        }
+    }
+    if (!pDataStore->SaveData(index, radioData)) {
+        failed++;
+        return;
+    }
+    imported++;
+}
@@ -0,0 +1,71 @@
+/* 
+* Copyright (c) 2026 Tomosawa 
+* https://github.com/Tomosawa/ 
+* All rights reserved 
+*/
+
+#ifndef __RADIODATASTREAM_H__
+#define __RADIODATASTREAM_H__
+#include <Arduino.h>
+#include "DataStore.h"
+
+// 单条记录一行的最大长度（名称按JSON转义后最长约6倍）
+#define RADIO_STREAM_LINE_SIZE 448
+
+/*
+ * 遥控码库的流式导出/导入，格式为每行一条JSON记录（NDJSON）：
+ * {"index":1,"name":"...","data":123,"bitLength":24,"protocol":1,"pulseLength":350,"freqType":1}
+ * 导出按槽位顺序逐条生成，导入按行解析，两者都只占用一行的缓冲区，
+ * 与码库大小无关。
+ */
+class RadioDataExporter
+{
+public:
+    RadioDataExporter(DataStore* store);
+    // 填充最多 maxLen 字节，返回写入的字节数，返回0表示导出结束
+    size_t Read(uint8_t* buffer, size_t maxLen);
+    int GetCount();
+
+private:
+    bool nextLine();
+
+    DataStore* pDataStore;
+    int slots[32];                               // 当前批次的已占用槽位
+    int slotCount;
+    int slotPos;
+    int nextIndex;
+    int count;
+    RadioData radioData;
+    char line[RADIO_STREAM_LINE_SIZE];
+    size_t lineLength;
+    size_t linePos;
+};
+
+/*
+ * 导入状态只包含定长成员，可直接放在 AsyncWebServerRequest::_tempObject 中
+ * （请求结束时由服务器 free()）。
+ * 覆盖导入时，第一条有效记录解析成功后才清空已有数据，无效文件不会清空码库。
+ * 记录指定的槽位已保存其他编码时不覆盖，改存到第一个空槽位。
+ */
+class RadioDataImporter
+{
+public:
+    void Begin(DataStore* store, bool replace);
+    void Write(const uint8_t* data, size_t len);
+    void End();                                  // 处理最后一行（没有换行结尾时）
+
+    int imported;                                // 新保存的条数
+    int duplicates;                              // 编码已存在而跳过的条数
+    int failed;                                  // 解析失败、字段超出范围、无空槽位等
+
+private:
+    void processLine();
+
+    DataStore* pDataStore;
+    char line[RADIO_STREAM_LINE_SIZE];
+    size_t lineLength;
+    bool overflow;                               // 当前行超长，丢弃到下一个换行
+    bool pendingClear;                           // 覆盖导入尚未清空已有数据
+};
+
+#endif
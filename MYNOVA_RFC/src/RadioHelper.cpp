@@ -7,13 +7,27 @@
 #include "RadioHelper.h"
 #include "IOPin.h"
 #include "Buzzer.h"
-#include "Lib/RCSwitchA.h"
-#include "Lib/RCSwitchB.h"
+#include "Lib/RCSwitch.h"
 #include "SystemSetting.h"
 #include "driver/gpio.h"
 
-RCSwitchA radioA = RCSwitchA();
-RCSwitchB radioB = RCSwitchB();
+// 射频频段配置表：新增频段只需在此追加一行
+struct RadioBand {
+    FreqType freqType;
+    int rxPin;
+    int txPin;
+    const char* name;
+};
+
+static const RadioBand radioBands[RADIO_BAND_COUNT] = {
+    { FREQ_315, PIN_RX_315, PIN_TX_315, "315" },
+    { FREQ_433, PIN_RX_433, PIN_TX_433, "433" },
+};
+
+// 每个频段一个收发实例，共用同一份收发代码和中断入口
+static RCSwitch radios[RADIO_BAND_COUNT];
+// 每个频段的RMT发送后端，发送期间不占用调用者的CPU
+static RmtPulsePlayer rmtPlayers[RADIO_BAND_COUNT];
 Buzzer buzzer(PIN_BUZZER);
 extern SystemSetting systemSetting;
 
@@ -22,14 +36,37 @@ static bool gpioIsrServiceInstalled = false;
 
 // 用于保护接收状态的互斥锁
 static SemaphoreHandle_t receiveMutex = nullptr;
+// 用于保护接收帧队列的互斥锁（接收任务写入，界面/Web/MQTT读取）
+static SemaphoreHandle_t frameQueueMutex = nullptr;
+// 每个频段的发送锁：setProtocol + send 必须整体完成，
+// RmtPulsePlayer 的符号缓冲区在发送期间不能被另一次发送改写
+static SemaphoreHandle_t transmitMutex[RADIO_BAND_COUNT] = {};
 
 RadioHelper::RadioHelper(): 
 bReciveMode(false),
-receiveStartSemaphore(nullptr),
-radioReceiveTaskHandle(nullptr)
+bContinuousMode(false),
+dedupWindowMs(RADIO_DEDUP_WINDOW_MS),
+frameSequence(0),
+lastDecodeLatency(0),
+radioReceiveTaskHandle(nullptr),
+radioSendTaskHandle(nullptr),
+sendQueue(nullptr)
 {
-    pinMode(PIN_RX_315, INPUT);
-    pinMode(PIN_RX_433, INPUT);
+    memset(frameQueue, 0, sizeof(frameQueue));
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        pinMode(radioBands[i].rxPin, INPUT);
+    }
+}
+
+// 根据频率类型查找频段索引
+static int findBand(FreqType freqType)
+{
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        if (radioBands[i].freqType == freqType) {
+            return i;
+        }
+    }
+    return 0;
 }
 
 void RadioHelper::init()
@@ -43,6 +80,14 @@ void RadioHelper::init()
     if (receiveMutex == nullptr) {
         receiveMutex = xSemaphoreCreateMutex();
     }
+    if (frameQueueMutex == nullptr) {
+        frameQueueMutex = xSemaphoreCreateMutex();
+    }
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        if (transmitMutex[i] == nullptr) {
+            transmitMutex[i] = xSemaphoreCreateMutex();
+        }
+    }
     
     // 从SystemSetting读取重复发送次数配置
     int repeatTransmit = systemSetting.getRepeatTransmit();
@@ -56,8 +101,11 @@ void RadioHelper::init()
         Serial.println("RadioHelper: 使用默认重复发送次数: 15");
     }
     
-    // 创建信号量，用于触发接收任务开始接收
-    receiveStartSemaphore = xSemaphoreCreateBinary();
+    // 发送器常驻使能：RMT在后台完成整段发送，不能在send()返回后立即释放
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        radios[i].setPulsePlayer(&rmtPlayers[i]);
+        radios[i].enableTransmit(radioBands[i].txPin);
+    }
     
     // 创建接收任务（堆栈大小增加以防止同时处理两个中断时栈溢出）
     xTaskCreate(
@@ -68,12 +116,47 @@ void RadioHelper::init()
         2,                          // 任务优先级
         &radioReceiveTaskHandle     // 任务句柄
     );
+
+    // 接收中断在帧完整时直接通知接收任务
+    RCSwitch::setNotifyTask(radioReceiveTaskHandle);
+
+    // 创建发送队列和发送任务
+    sendQueue = xQueueCreate(RADIO_SEND_QUEUE_SIZE, sizeof(RCData));
+    xTaskCreate(
+        radioSendTask,              // 任务函数
+        "RadioSendTask",            // 任务名称
+        4096,                       // 任务堆栈大小
+        this,                       // 任务参数
+        2,                          // 任务优先级
+        &radioSendTaskHandle        // 任务句柄
+    );
 }
 
 void RadioHelper::EnableRecive()
 {
     Serial.println("EnableRecive315&433");
-    
+    startReceive(false);
+}
+
+void RadioHelper::EnableSniffer()
+{
+    Serial.println("EnableSniffer315&433");
+    startReceive(true);
+}
+
+bool RadioHelper::IsSnifferEnabled()
+{
+    return bReciveMode && bContinuousMode;
+}
+
+void RadioHelper::SetDedupWindow(uint32_t windowMs)
+{
+    dedupWindowMs = windowMs;
+}
+
+// 单次接收：收到第一帧后停止；连续接收：保持接收直到 DisableRecive()
+void RadioHelper::startReceive(bool continuous)
+{
     // 获取互斥锁，确保线程安全
     if (receiveMutex != nullptr) {
         xSemaphoreTake(receiveMutex, portMAX_DELAY);
@@ -81,8 +164,9 @@ void RadioHelper::EnableRecive()
     
     // 如果已经在接收模式，先完全禁用
     if (bReciveMode) {
-        radioA.disableReceive();
-        radioB.disableReceive();
+        for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+            radios[i].disableReceive();
+        }
         bReciveMode = false;
         // 给一点时间让中断完全停止
         vTaskDelay(pdMS_TO_TICKS(10));
@@ -90,26 +174,20 @@ void RadioHelper::EnableRecive()
     
     // 清空之前的数据
     memset(&rcData, 0, sizeof(rcData));
-    radioA.resetAvailable();
-    radioB.resetAvailable();
    
-    // 启用接收
-    radioA.enableReceive(PIN_RX_315);
-    radioB.enableReceive(PIN_RX_433);
+    // 启用所有频段接收
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        radios[i].resetAvailable();
+        radios[i].enableReceive(radioBands[i].rxPin);
+    }
 
+    bContinuousMode = continuous;
     bReciveMode = true;
     
     // 释放互斥锁
     if (receiveMutex != nullptr) {
         xSemaphoreGive(receiveMutex);
     }
-    
-    // 发送信号量，通知接收任务开始工作
-    // 使用 xSemaphoreGive 前先尝试清空信号量，避免累积
-    if (receiveStartSemaphore != nullptr) {
-        xSemaphoreTake(receiveStartSemaphore, 0); // 非阻塞清空
-        xSemaphoreGive(receiveStartSemaphore);
-    }
 }
 
 void RadioHelper::DisableRecive()
@@ -123,8 +201,9 @@ void RadioHelper::DisableRecive()
     
     if (bReciveMode) {
         bReciveMode = false;
-        radioA.disableReceive();
-        radioB.disableReceive();
+        for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+            radios[i].disableReceive();
+        }
     }
     
     // 释放互斥锁
@@ -135,11 +214,34 @@ void RadioHelper::DisableRecive()
 
 void RadioHelper::SetRepeatTransmit(int nRepeatTransmit)
 {
-    radioA.setRepeatTransmit(nRepeatTransmit);
-    radioB.setRepeatTransmit(nRepeatTransmit);
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        radios[i].setRepeatTransmit(nRepeatTransmit);
+    }
 }
 
-void RadioHelper::SendData(RCData data)
+// 界面、Web、MQTT都从这里发送：只把数据放入发送队列，立即返回
+bool RadioHelper::SendData(RCData data)
+{
+    if (sendQueue == nullptr || xQueueSend(sendQueue, &data, 0) != pdTRUE) {
+        Serial.println("SendData: 发送队列已满，丢弃");
+        return false;
+    }
+    return true;
+}
+
+void RadioHelper::radioSendTask(void* pvParameters)
+{
+    RadioHelper* self = (RadioHelper*)pvParameters;
+    RCData data;
+    while (true) {
+        if (xQueueReceive(self->sendQueue, &data, portMAX_DELAY) == pdTRUE) {
+            self->transmit(data);
+        }
+    }
+}
+
+// 在发送任务中执行
+void RadioHelper::transmit(const RCData& data)
 {
     Serial.println("SendData");
     
@@ -149,107 +251,199 @@ void RadioHelper::SendData(RCData data)
         DisableRecive();
     }
 
-    if(data.freqType == FREQ_315){
-        Serial.println("enableTransmit315");
-        radioA.enableTransmit(PIN_TX_315);
-        radioA.setProtocol(data.protocal, data.pulseLength);
-        Serial.println("send315");
-        radioA.send(data.data, data.bitLength);
-        radioA.disableTransmit();  // 发送完成后禁用发送器
+    const int bandIndex = findBand(data.freqType);
+    const RadioBand& band = radioBands[bandIndex];
+    RCSwitch& radio = radios[bandIndex];
+    Serial.print("send");
+    Serial.println(band.name);
+
+    // 获取本频段的发送锁，协议设置和发送之间不能插入其他发送
+    if (transmitMutex[bandIndex] != nullptr) {
+        xSemaphoreTake(transmitMutex[bandIndex], portMAX_DELAY);
     }
-    else{
-        Serial.println("enableTransmit433");
-        radioB.enableTransmit(PIN_TX_433);
-        radioB.setProtocol(data.protocal, data.pulseLength);
-        Serial.println("send433");
-        radioB.send(data.data, data.bitLength);
-        radioB.disableTransmit();  // 发送完成后禁用发送器
+    radio.setProtocol(data.protocal, data.pulseLength);
+    // 新版本核心由RMT硬件重复发送，这里很快返回；旧版本核心和GPIO回退会阻塞到发送结束，
+    // 阻塞的只是发送任务
+    radio.send(data.data, data.bitLength);
+    if (transmitMutex[bandIndex] != nullptr) {
+        xSemaphoreGive(transmitMutex[bandIndex]);
     }
     
-    Serial.println("SendData complete");
+    Serial.println("SendData done");
+
+    // 恢复发送前的接收模式；硬件发送在后台进行，等本频段发完再开启，避免收到自己发出的信号
+    if (wasReceiving) {
+        while (radio.isTransmitting()) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+        startReceive(bContinuousMode);
+    }
 
-    // 使用非阻塞方式启动蜂鸣器，避免阻塞按键任务
+    // 使用非阻塞方式启动蜂鸣器
     buzzer.beep(100);
 }
 
+// 写入接收帧队列：去重窗口内已有相同的帧时只累加重复次数
+// 窗口从该帧首次收到时计算，持续按住遥控器时每个窗口仍会产生一条新帧
+void RadioHelper::pushFrame(const RCData& data)
+{
+    const uint32_t now = millis();
+    xSemaphoreTake(frameQueueMutex, portMAX_DELAY);
+
+    const uint32_t count = (frameSequence < RADIO_FRAME_QUEUE_SIZE) ? frameSequence : RADIO_FRAME_QUEUE_SIZE;
+    for (uint32_t i = 0; i < count; i++) {
+        RadioFrame& frame = frameQueue[(frameSequence - i) % RADIO_FRAME_QUEUE_SIZE];
+        // 从新到旧遍历，首次收到时间单调递增，超出窗口后更旧的帧也都超出
+        if (now - frame.timestamp > dedupWindowMs) {
+            break;
+        }
+        if (frame.rcData.data == data.data && frame.rcData.bitLength == data.bitLength &&
+            frame.rcData.protocal == data.protocal && frame.rcData.freqType == data.freqType) {
+            frame.lastSeen = now;
+            if (frame.repeatCount < 0xFFFF) {
+                frame.repeatCount++;
+            }
+            xSemaphoreGive(frameQueueMutex);
+            return;
+        }
+    }
+
+    frameSequence++;
+    RadioFrame& frame = frameQueue[frameSequence % RADIO_FRAME_QUEUE_SIZE];
+    frame.sequence = frameSequence;
+    frame.rcData = data;
+    frame.timestamp = now;
+    frame.lastSeen = now;
+    frame.repeatCount = 1;
+
+    xSemaphoreGive(frameQueueMutex);
+}
+
+uint32_t RadioHelper::GetFrameSequence()
+{
+    return frameSequence;
+}
+
+// 读取游标之后的下一帧；游标落后超过队列容量时从最旧的一帧继续
+bool RadioHelper::ReadFrame(uint32_t& cursor, RadioFrame& frame)
+{
+    if (frameQueueMutex == nullptr) {
+        return false;
+    }
+    xSemaphoreTake(frameQueueMutex, portMAX_DELAY);
+    bool found = false;
+    if (cursor < frameSequence) {
+        const uint32_t oldest = (frameSequence > RADIO_FRAME_QUEUE_SIZE) ? frameSequence - RADIO_FRAME_QUEUE_SIZE + 1 : 1;
+        const uint32_t next = (cursor + 1 > oldest) ? cursor + 1 : oldest;
+        frame = frameQueue[next % RADIO_FRAME_QUEUE_SIZE];
+        cursor = next;
+        found = true;
+    }
+    xSemaphoreGive(frameQueueMutex);
+    return found;
+}
+
+uint32_t RadioHelper::GetDroppedFrameCount(FreqType freqType)
+{
+    return radios[findBand(freqType)].getDroppedFrameCount();
+}
+
+uint32_t RadioHelper::GetOverflowCount(FreqType freqType)
+{
+    return radios[findBand(freqType)].getOverflowCount();
+}
+
+uint32_t RadioHelper::GetLastDecodeLatency()
+{
+    return lastDecodeLatency;
+}
+
+void RadioHelper::GetDecodeStats(FreqType freqType, uint32_t& frames, uint32_t& attempts, uint32_t& decodeMicros)
+{
+    radios[findBand(freqType)].getDecodeStats(frames, attempts, decodeMicros);
+}
+
+void RadioHelper::ResetDecodeStats()
+{
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        radios[i].resetDecodeStats();
+    }
+}
+
+void RadioHelper::SetProtocolIndexEnabled(bool enabled)
+{
+    for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+        radios[i].setProtocolIndexEnabled(enabled);
+    }
+}
+
 // 接收任务函数
 void RadioHelper::radioReceiveTask(void* pvParameters)
 {
     RadioHelper* radioHelper = static_cast<RadioHelper*>(pvParameters);
     
     while (true) {
-        // 等待信号量，表示需要开始接收
-        if (xSemaphoreTake(radioHelper->receiveStartSemaphore, portMAX_DELAY) == pdTRUE) {
-            // 循环等待接收数据
-            while (radioHelper->bReciveMode) {
-                // 使用互斥锁保护对 radioA/radioB 的访问
-                bool dataReceived = false;
-                
-                if (receiveMutex != nullptr) {
-                    // 使用短超时，避免长时间阻塞
-                    if (xSemaphoreTake(receiveMutex, pdMS_TO_TICKS(5)) == pdTRUE) {
-                        // 再次检查接收模式，因为在等待锁时可能已被禁用
-                        if (!radioHelper->bReciveMode) {
-                            xSemaphoreGive(receiveMutex);
-                            break;
-                        }
-                        
-                        // 在任务中执行解码（而不是在ISR中）
-                        radioA.tryDecode();
-                        radioB.tryDecode();
-                        
-                        if (radioA.available()) {
-                            Serial.print("Received 315");
-                            radioHelper->rcData.freqType = FREQ_315;
-                            Serial.print( radioHelper->rcData.data = radioA.getReceivedValue() );
-                            Serial.print(" / ");
-                            Serial.print( radioHelper->rcData.bitLength = radioA.getReceivedBitlength() );
-                            Serial.print("bit ");
-                            Serial.print("Protocol: ");
-                            Serial.println( radioHelper->rcData.protocal = radioA.getReceivedProtocol() );
-                            Serial.print("ReceivedDelay:");
-                            Serial.println(radioHelper->rcData.pulseLength = radioA.getReceivedDelay());
-                            radioA.resetAvailable();
-                            
-                            // 停止接收
-                            radioHelper->bReciveMode = false;
-                            radioA.disableReceive();
-                            radioB.disableReceive();
-                            dataReceived = true;
-                        }
-                        else if (radioB.available()) {
-                            Serial.print("Received 433");
-                            radioHelper->rcData.freqType = FREQ_433;
-                            Serial.print( radioHelper->rcData.data = radioB.getReceivedValue() );
-                            Serial.print(" / ");
-                            Serial.print( radioHelper->rcData.bitLength = radioB.getReceivedBitlength() );
-                            Serial.print("bit ");
-                            Serial.print("Protocol: ");
-                            Serial.println( radioHelper->rcData.protocal = radioB.getReceivedProtocol() );
-                            Serial.print("ReceivedDelay:");
-                            Serial.println(radioHelper->rcData.pulseLength = radioB.getReceivedDelay());
-                            radioB.resetAvailable();
-                            
-                            // 停止接收
-                            radioHelper->bReciveMode = false;
-                            radioA.disableReceive();
-                            radioB.disableReceive();
-                            dataReceived = true;
-                        }
-                        
-                        xSemaphoreGive(receiveMutex);
+        // 阻塞等待接收中断通知有完整帧，空闲时不占用CPU
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        bool dataReceived = false;
+
+        // 使用互斥锁保护对射频实例的访问
+        xSemaphoreTake(receiveMutex, portMAX_DELAY);
+        const bool continuous = radioHelper->bContinuousMode;
+
+        // 等待锁时接收可能已被禁用，此时丢弃通知
+        if (radioHelper->bReciveMode) {
+            // 在任务中执行解码（而不是在ISR中）
+            // 单次接收取第一个解码成功的频段；连续接收取完所有频段排队的帧
+            for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+                RCSwitch& radio = radios[i];
+                while (true) {
+                    radio.tryDecode();
+                    if (!radio.available()) {
+                        break;
                     }
+                    radioHelper->lastDecodeLatency = micros() - radio.getReceivedTimestamp();
+                    Serial.print("Received ");
+                    Serial.print(radioBands[i].name);
+                    radioHelper->rcData.freqType = radioBands[i].freqType;
+                    Serial.print( radioHelper->rcData.data = radio.getReceivedValue() );
+                    Serial.print(" / ");
+                    Serial.print( radioHelper->rcData.bitLength = radio.getReceivedBitlength() );
+                    Serial.print("bit ");
+                    Serial.print("Protocol: ");
+                    Serial.println( radioHelper->rcData.protocal = radio.getReceivedProtocol() );
+                    Serial.print("ReceivedDelay:");
+                    Serial.println(radioHelper->rcData.pulseLength = radio.getReceivedDelay());
+                    Serial.print("DecodeLatency(us):");
+                    Serial.println(radioHelper->lastDecodeLatency);
+                    radio.resetAvailable();
+                    radioHelper->pushFrame(radioHelper->rcData);
+                    dataReceived = true;
+                    if (!continuous) {
+                        break;
+                    }
+                }
+                if (dataReceived && !continuous) {
+                    break;
                 }
-                
-                if (dataReceived) {
-                    // 蜂鸣器（在互斥锁外调用）
-                    buzzer.beep(500);
-                    break; // 跳出循环，等待下一个信号量
+            }
+
+            if (dataReceived && !continuous) {
+                // 停止接收
+                radioHelper->bReciveMode = false;
+                for (int i = 0; i < RADIO_BAND_COUNT; i++) {
+                    radios[i].disableReceive();
                 }
-                
-                // 短暂延迟以避免过度占用CPU
-                vTaskDelay(pdMS_TO_TICKS(10));
             }
         }
+        
+        xSemaphoreGive(receiveMutex);
+        
+        // 连续接收模式下不鸣叫，避免繁忙环境中持续发声
+        if (dataReceived && !continuous) {
+            // 蜂鸣器（在互斥锁外调用）
+            buzzer.beep(500);
+        }
     }
 }
\ No newline at end of file
@@ -13,6 +13,9 @@ enum FreqType{
     FREQ_433 = 1
 };
 
+// 射频频段数量（每个频段对应一组收发引脚，见 RadioHelper.cpp 中的 radioBands）
+#define RADIO_BAND_COUNT 2
+
 struct RCData{
     unsigned long data;//数据
     unsigned int bitLength;//位长度
@@ -21,6 +24,22 @@ struct RCData{
     FreqType freqType;
 };
 
+// 接收帧队列容量（条）：所有订阅者共用，读得慢的订阅者会跳过被覆盖的旧帧
+#define RADIO_FRAME_QUEUE_SIZE 32
+// 默认去重窗口（毫秒）：从首次收到起，窗口内重复收到的同一帧只累加重复次数
+#define RADIO_DEDUP_WINDOW_MS 500
+// 发送队列容量（条）：SendData() 只排队，由发送任务依次发出
+#define RADIO_SEND_QUEUE_SIZE 4
+
+// 接收帧队列中的一条记录
+struct RadioFrame{
+    uint32_t sequence;//序号（从1开始递增），订阅者以此作为读取游标
+    RCData rcData;//解码结果（含频段）
+    uint32_t timestamp;//首次收到的时间（millis）
+    uint32_t lastSeen;//最近一次收到的时间（millis）
+    uint16_t repeatCount;//去重窗口内收到的次数
+};
+
 class RadioHelper
 {
 public:
@@ -29,20 +48,55 @@ public:
     void EnableRecive();
     void DisableRecive();
     void SetRepeatTransmit(int nRepeatTransmit);
-    void SendData(RCData data);
+    bool SendData(RCData data);               // 只排队不阻塞，队列满返回false
+
+    // 连续接收（嗅探）模式：两个频段保持接收，每个解码帧都进入接收帧队列
+    void EnableSniffer();
+    bool IsSnifferEnabled();
+    void SetDedupWindow(uint32_t windowMs);
+
+    // 接收帧队列订阅：每个订阅者持有自己的游标，互不影响
+    // GetFrameSequence() 返回最新帧序号，作为只读取之后新帧的初始游标
+    uint32_t GetFrameSequence();
+    bool ReadFrame(uint32_t& cursor, RadioFrame& frame);
+
+    // 接收统计：帧队列满被丢弃的完整帧数 / 边沿缓冲区溢出次数
+    uint32_t GetDroppedFrameCount(FreqType freqType);
+    uint32_t GetOverflowCount(FreqType freqType);
+
+    // 最近一次解码延迟：帧最后一个边沿到解码完成的时间（微秒）
+    uint32_t GetLastDecodeLatency();
+
+    // 解码开销统计（帧数 / receiveProtocol尝试次数 / 累计解码微秒），用于对比协议索引与线性扫描
+    void GetDecodeStats(FreqType freqType, uint32_t& frames, uint32_t& attempts, uint32_t& decodeMicros);
+    void ResetDecodeStats();
+    void SetProtocolIndexEnabled(bool enabled);
     
 public:
     RCData rcData;
     
 private:
     bool bReciveMode;
+    bool bContinuousMode;                     // 解码后不停止接收
+    uint32_t dedupWindowMs;
+
+    // 接收帧队列（环形，按序号取模存放）
+    RadioFrame frameQueue[RADIO_FRAME_QUEUE_SIZE];
+    uint32_t frameSequence;                   // 最新帧序号，0表示队列为空
+    void pushFrame(const RCData& data);
+    void startReceive(bool continuous);
+    void transmit(const RCData& data);
+    volatile uint32_t lastDecodeLatency;
     
     // FreeRTOS相关成员
-    SemaphoreHandle_t receiveStartSemaphore;  // 接收开始信号量
-    TaskHandle_t radioReceiveTaskHandle;      // 接收任务句柄
+    TaskHandle_t radioReceiveTaskHandle;      // 接收任务句柄（由接收中断直接通知）
+    TaskHandle_t radioSendTaskHandle;         // 发送任务句柄
+    QueueHandle_t sendQueue;                  // 待发送的数据（RCData）
     
     // 接收任务函数
     static void radioReceiveTask(void* pvParameters);
+    // 发送任务函数：发送可能阻塞（旧版本核心逐帧rmtWrite、GPIO回退），不能占用界面/网络任务
+    static void radioSendTask(void* pvParameters);
 };
 
 #endif
\ No newline at end of file
@@ -20,6 +20,11 @@ SystemSetting::SystemSetting() {
     lastActivityTime = 0;
     isScreenOff = false;
     pWiFiManager = nullptr;
+    dirtyFields = 0;
+    lastDirtyTime = 0;
+    dirtyLock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&saveStats, 0, sizeof(saveStats));
+    configMutex = xSemaphoreCreateMutex();
 }
 
 void SystemSetting::init(WiFiManager* wifiMgr) {
@@ -75,6 +80,11 @@ void SystemSetting::update() {
     if (config.autoScreenOffTime > 0) {
         checkAutoScreenOff();
     }
+    
+    // 配置修改静默一段时间后再写入，连续调节只产生一次写入
+    if (dirtyFields != 0 && millis() - lastDirtyTime >= CONFIG_SAVE_DELAY_MS) {
+        saveConfig();
+    }
 }
 
 void SystemSetting::resetIdleTimer() {
@@ -116,6 +126,9 @@ void SystemSetting::checkAutoScreenOff() {
 void SystemSetting::enterSleep() {
     Serial.println("SystemSetting: 进入深度休眠模式（Deep Sleep）");
     
+    // 休眠会重启设备，先写入待保存的配置
+    saveConfig();
+    
     // 关闭屏幕
     screenOff();
     
@@ -192,8 +205,9 @@ void SystemSetting::wakeUp() {
     screenOn();
     
     // 重启AP（如果之前启用）- 通过WiFiManager
-    if (config.APEnabled && pWiFiManager) {
-        pWiFiManager->startAPAsync(config.APName, config.APPassword);
+    SystemConfig snapshot = getConfig();
+    if (snapshot.APEnabled && pWiFiManager) {
+        pWiFiManager->startAPAsync(snapshot.APName, snapshot.APPassword);
     }
     
     // 重置计时器
@@ -228,147 +242,248 @@ void SystemSetting::applyBrightness() {
 
 // 获取和设置配置
 SystemConfig SystemSetting::getConfig() {
-    return config;
+    xSemaphoreTake(configMutex, portMAX_DELAY);
+    SystemConfig snapshot = config;
+    xSemaphoreGive(configMutex);
+    return snapshot;
 }
 
 void SystemSetting::setConfig(SystemConfig newConfig, bool saveToFlash) {
+    unsigned long startMicros = micros();
+    xSemaphoreTake(configMutex, portMAX_DELAY);
     config = newConfig;
+    xSemaphoreGive(configMutex);
     
     // 应用配置
     applyBrightness();
     
     // 处理AP - 通过WiFiManager
     if (pWiFiManager) {
-        if (config.APEnabled && !pWiFiManager->isAPStarted()) {
-            pWiFiManager->startAPAsync(config.APName, config.APPassword);
-        } else if (!config.APEnabled && pWiFiManager->isAPStarted()) {
+        if (newConfig.APEnabled && !pWiFiManager->isAPStarted()) {
+            pWiFiManager->startAPAsync(newConfig.APName, newConfig.APPassword);
+        } else if (!newConfig.APEnabled && pWiFiManager->isAPStarted()) {
             pWiFiManager->stopAP();
         }
         
         // 处理WiFi - 通过WiFiManager
-        if (config.WifiEnabled && !pWiFiManager->isConnected()) {
-            pWiFiManager->connectToWiFiAsync(config.WifiName, config.WifiPassword);
-        } else if (!config.WifiEnabled && pWiFiManager->isConnected()) {
+        if (newConfig.WifiEnabled && !pWiFiManager->isConnected()) {
+            pWiFiManager->connectToWiFiAsync(newConfig.WifiName, newConfig.WifiPassword);
+        } else if (!newConfig.WifiEnabled && pWiFiManager->isConnected()) {
             pWiFiManager->disconnect();
         }
     }
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_ALL);
+    }
+    recordSetterTime(startMicros);
+}
+
+void SystemSetting::markDirty(uint32_t fields) {
+    portENTER_CRITICAL(&dirtyLock);
+    dirtyFields |= fields;
+    lastDirtyTime = millis();
+    portEXIT_CRITICAL(&dirtyLock);
+}
+
+void SystemSetting::recordSetterTime(unsigned long startMicros) {
+    uint32_t elapsed = micros() - startMicros;
+    portENTER_CRITICAL(&dirtyLock);
+    saveStats.setterCalls++;
+    saveStats.setterTotalMicros += elapsed;
+    if (elapsed > saveStats.setterMaxMicros) {
+        saveStats.setterMaxMicros = elapsed;
     }
+    portEXIT_CRITICAL(&dirtyLock);
 }
 
 void SystemSetting::saveConfig() {
+    portENTER_CRITICAL(&dirtyLock);
+    uint32_t fields = dirtyFields;
+    dirtyFields = 0;
+    portEXIT_CRITICAL(&dirtyLock);
+    if (fields == 0) {
+        return;
+    }
+    
     Serial.println("SystemSetting: 保存配置到存储");
-    dataStore.SaveSystemConfig(config);
+    unsigned long startMicros = micros();
+    // 从快照写入，写Flash期间设置方法可以继续修改config
+    SystemConfig snapshot = getConfig();
+    int written = dataStore.SaveSystemConfig(snapshot, fields);
+    uint32_t elapsed = micros() - startMicros;
+    
+    portENTER_CRITICAL(&dirtyLock);
+    if (written == 0) {
+        // 写入失败（存储忙），保留修改标记，下次update()重试
+        dirtyFields |= fields;
+        lastDirtyTime = millis();
+    } else {
+        saveStats.flushCount++;
+        saveStats.keysWritten += written;
+        if (elapsed > saveStats.flushMaxMicros) {
+            saveStats.flushMaxMicros = elapsed;
+        }
+    }
+    portEXIT_CRITICAL(&dirtyLock);
+}
+
+void SystemSetting::discardPendingSave() {
+    portENTER_CRITICAL(&dirtyLock);
+    dirtyFields = 0;
+    portEXIT_CRITICAL(&dirtyLock);
+}
+
+bool SystemSetting::hasPendingSave() {
+    return dirtyFields != 0;
+}
+
+ConfigSaveStats SystemSetting::getSaveStats() {
+    portENTER_CRITICAL(&dirtyLock);
+    ConfigSaveStats stats = saveStats;
+    portEXIT_CRITICAL(&dirtyLock);
+    return stats;
 }
 
 // 单独设置项的方法
 void SystemSetting::setBrightness(int brightness, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.brightness = brightness;
     applyBrightness();
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_BRIGHTNESS);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setBuzzerEnable(bool enable, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.buzzerEnable = enable;
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_BUZZER_ENABLE);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setRepeatTransmit(int times, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.repeatTransmit = times;
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_REPEAT_TRANSMIT);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setAutoSleepTime(long timeMs, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.autoSleepTime = timeMs;
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_AUTO_SLEEP_TIME);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setAutoScreenOffTime(long timeMs, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.autoScreenOffTime = timeMs;
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_AUTO_SCREEN_OFF);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setAPEnabled(bool enabled, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.APEnabled = enabled;
     
-    // 先保存配置，再启动异步任务，避免并发冲突
+    // 只标记待保存，由主循环在静默后写入，不在此处阻塞等待存储锁
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_AP_ENABLED);
     }
     
     // 通过WiFiManager控制AP
     if (pWiFiManager) {
-        if (config.APEnabled) {
-            pWiFiManager->startAPAsync(config.APName, config.APPassword);
+        if (enabled) {
+            SystemConfig snapshot = getConfig();
+            pWiFiManager->startAPAsync(snapshot.APName, snapshot.APPassword);
         } else {
             pWiFiManager->stopAP();
         }
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setWifiEnabled(bool enabled, bool saveToFlash) {
+    unsigned long startMicros = micros();
     config.WifiEnabled = enabled;
     
-    // 先保存配置，再启动异步任务，避免并发冲突
+    // 只标记待保存，由主循环在静默后写入，不在此处阻塞等待存储锁
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_WIFI_ENABLED);
     }
     
     // 通过WiFiManager控制WiFi
     if (pWiFiManager) {
-        if (config.WifiEnabled && !pWiFiManager->isConnected()) {
-            pWiFiManager->connectToWiFiAsync(config.WifiName, config.WifiPassword);
-        } else if (!config.WifiEnabled && pWiFiManager->isConnected()) {
+        if (enabled && !pWiFiManager->isConnected()) {
+            SystemConfig snapshot = getConfig();
+            pWiFiManager->connectToWiFiAsync(snapshot.WifiName, snapshot.WifiPassword);
+        } else if (!enabled && pWiFiManager->isConnected()) {
             pWiFiManager->disconnect();
         }
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setAPConfig(String name, String password, bool saveToFlash) {
+    unsigned long startMicros = micros();
+    xSemaphoreTake(configMutex, portMAX_DELAY);
     config.APName = name;
     config.APPassword = password;
+    xSemaphoreGive(configMutex);
     
     // 如果AP正在运行，重启以应用新配置
     if (config.APEnabled && pWiFiManager) {
         pWiFiManager->stopAP();
-        pWiFiManager->startAPAsync(config.APName, config.APPassword);
+        pWiFiManager->startAPAsync(name, password);
     }
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_AP_NAME | CONFIG_FIELD_AP_PASSWORD);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 void SystemSetting::setWifiConfig(String ssid, String password, bool saveToFlash) {
+    unsigned long startMicros = micros();
+    xSemaphoreTake(configMutex, portMAX_DELAY);
     config.WifiName = ssid;
     config.WifiPassword = password;
+    xSemaphoreGive(configMutex);
     
     // 如果WiFi已连接，断开并重新连接
     if (config.WifiEnabled && pWiFiManager && pWiFiManager->isConnected()) {
         pWiFiManager->disconnect();
-        pWiFiManager->connectToWiFiAsync(config.WifiName, config.WifiPassword);
+        pWiFiManager->connectToWiFiAsync(ssid, password);
     }
     
     if (saveToFlash) {
-        saveConfig();
+        markDirty(CONFIG_FIELD_WIFI_NAME | CONFIG_FIELD_WIFI_PASSWORD);
     }
+    
+    recordSetterTime(startMicros);
 }
 
 // 获取单独的配置项
@@ -405,10 +520,12 @@ void SystemSetting::setMQTTEnabled(bool enabled, bool saveToFlash) {
 }
 
 void SystemSetting::setMQTTConfig(String server, int port, String username, String password, bool saveToFlash) {
+    xSemaphoreTake(configMutex, portMAX_DELAY);
     config.MQTTServer = server;
     config.MQTTPort = port;
     config.MQTTUsername = username;
     config.MQTTPassword = password;
+    xSemaphoreGive(configMutex);
     
     if (saveToFlash) {
         saveConfig();
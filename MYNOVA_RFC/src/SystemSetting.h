@@ -16,6 +16,19 @@
 #define DEFAULT_AP_NAME "MYNOVA_RFC"
 #define DEFAULT_AP_PASSWORD "MYNOVA123"
 
+// 配置修改后延迟写入Flash的静默时间（毫秒），期间的连续修改合并为一次写入
+#define CONFIG_SAVE_DELAY_MS 2000
+
+// 配置写入统计
+struct ConfigSaveStats {
+    uint32_t setterCalls;       // 设置方法调用次数
+    uint32_t setterMaxMicros;   // 设置方法最长耗时（微秒）
+    uint32_t setterTotalMicros; // 设置方法累计耗时（微秒）
+    uint32_t flushCount;        // 实际写入Flash的次数
+    uint32_t keysWritten;       // 写入的键总数
+    uint32_t flushMaxMicros;    // 单次写入最长耗时（微秒）
+};
+
 class SystemSetting {
 public:
     SystemSetting();
@@ -28,7 +41,10 @@ public:
     // 获取和设置配置
     SystemConfig getConfig();
     void setConfig(SystemConfig config, bool saveToFlash = false);
-    void saveConfig(); // 保存到存储
+    void saveConfig(); // 立即把待保存的修改写入存储（休眠、重启前调用）
+    void discardPendingSave(); // 丢弃待保存的修改（恢复出厂设置前调用）
+    bool hasPendingSave();
+    ConfigSaveStats getSaveStats();
     
     // 单独设置项的方法（会立即生效）
     void setBrightness(int brightness, bool saveToFlash = false);
@@ -59,14 +75,24 @@ public:
 
 private:
     SystemConfig config;
+    // 保护config中的String字段：设置方法可能在网络任务中调用，写入Flash在主循环中进行
+    SemaphoreHandle_t configMutex;
     WiFiManager* pWiFiManager; // WiFiManager指针
     unsigned long lastActivityTime; // 最后活动时间戳（毫秒）
     bool isScreenOff; // 屏幕是否已关闭
     
+    // 延迟写入：saveToFlash只标记修改的字段，静默CONFIG_SAVE_DELAY_MS后由update()统一写入
+    uint32_t dirtyFields;
+    unsigned long lastDirtyTime;
+    portMUX_TYPE dirtyLock;
+    ConfigSaveStats saveStats;
+    
     void checkAutoSleep(); // 检查是否需要自动休眠
     void checkAutoScreenOff(); // 检查是否需要自动息屏
     void wakeUp(); // 从休眠唤醒
     void applyBrightness(); // 应用亮度设置
+    void markDirty(uint32_t fields);
+    void recordSetterTime(unsigned long startMicros);
 };
 
 #endif
\ No newline at end of file
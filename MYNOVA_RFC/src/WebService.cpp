@@ -10,11 +10,21 @@
 #include "SystemSetting.h"
 #include "RadioHelper.h"
 #include "HAManager.h"
+#include "RadioBenchmark.h"
+#include "DataStoreBenchmark.h"
+#include "RadioDataStream.h"
+#include "GUIRender.h"
+#include "ButtonHandle.h"
+#include "GUI/FrameProfiler.h"
+#include <new>
+#include <type_traits>
 
 extern DataStore dataStore;
 extern SystemSetting systemSetting;
 extern RadioHelper radioHelper;
 extern HAManager haManager;
+extern GUIRender guiRender;
+extern ButtonHandle buttonHandle;
 void handleRequest(AsyncWebServerRequest *request){}
 void handleUploadRequest(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final){}
 
@@ -57,6 +67,7 @@ void WebService::serverStart()
     server.on(AsyncURIMatcher("/api/apwifiinfo"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleAPWIFIInfoRequest, this, std::placeholders::_1));
     server.on(AsyncURIMatcher("/api/apsave"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleAPSaveRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
     server.on(AsyncURIMatcher("/api/apenable"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleAPEnableRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
+    server.on(AsyncURIMatcher("/api/config/stats"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleConfigStatsRequest, this, std::placeholders::_1));
     
     // 无线遥控数据管理接口
     server.on(AsyncURIMatcher("/api/radiodata/list"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleRadioDataListRequest, this, std::placeholders::_1));
@@ -64,6 +75,15 @@ void WebService::serverStart()
     server.on(AsyncURIMatcher("/api/radiodata/update"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleRadioDataUpdateRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
     server.on(AsyncURIMatcher("/api/radiodata/delete"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleRadioDataDeleteRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
     server.on(AsyncURIMatcher("/api/radiodata/send"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleRadioDataSendRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
+    server.on(AsyncURIMatcher("/api/radiodata/export"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleRadioDataExportRequest, this, std::placeholders::_1));
+    server.on(AsyncURIMatcher("/api/radiodata/import"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleRadioDataImportRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
+    server.on(AsyncURIMatcher("/api/radio/benchmark"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleRadioBenchmarkRequest, this, std::placeholders::_1));
+    server.on(AsyncURIMatcher("/api/datastore/benchmark"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleDataStoreBenchmarkRequest, this, std::placeholders::_1));
+    server.on(AsyncURIMatcher("/api/gui/profiler"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleGUIProfilerRequest, this, std::placeholders::_1));
+    server.on(AsyncURIMatcher("/api/gui/frame"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleGUIFrameRequest, this, std::placeholders::_1));
+    server.on(AsyncURIMatcher("/api/gui/input"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleGUIInputRequest, this, std::placeholders::_1));
+    server.on(AsyncURIMatcher("/api/radio/sniffer"), HTTP_POST, handleRequest, handleUploadRequest, (ArBodyHandlerFunction)std::bind(&WebService::handleSnifferEnableRequest, this, std::placeholders::_1,std::placeholders::_2,std::placeholders::_3,std::placeholders::_4,std::placeholders::_5));
+    server.on(AsyncURIMatcher("/api/radio/sniffer/frames"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleSnifferFramesRequest, this, std::placeholders::_1));
     
     // MQTT/HA配置接口
     server.on(AsyncURIMatcher("/api/mqtt/config"), HTTP_GET, (ArRequestHandlerFunction)std::bind(&WebService::handleMQTTConfigGetRequest, this, std::placeholders::_1));
@@ -153,27 +173,52 @@ void WebService::handleWIFIConnectRequest(AsyncWebServerRequest *request)
 }
 
 
+// 配置写入统计：设置方法耗时与实际Flash写入次数
+void WebService::handleConfigStatsRequest(AsyncWebServerRequest *request)
+{
+    ConfigSaveStats stats = systemSetting.getSaveStats();
+    JsonDocument doc;
+    doc["result"] = "OK";
+    doc["pending"] = systemSetting.hasPendingSave();
+    doc["setterCalls"] = stats.setterCalls;
+    doc["setterMaxMicros"] = stats.setterMaxMicros;
+    doc["setterAvgMicros"] = stats.setterCalls > 0 ? stats.setterTotalMicros / stats.setterCalls : 0;
+    doc["flushCount"] = stats.flushCount;
+    doc["keysWritten"] = stats.keysWritten;
+    doc["flushMaxMicros"] = stats.flushMaxMicros;
+    
+    String output;
+    serializeJson(doc, output);
+    request->send(200, "application/json", output);
+}
+
 // 无线遥控数据管理接口实现
 void WebService::handleRadioDataListRequest(AsyncWebServerRequest *request)
 {   
     JsonDocument doc;
     JsonArray dataArray = doc["data"].to<JsonArray>();
     
-    // 读取所有数据位置（1-100）
-    for (int i = 1; i <= 100; i++) {
-        RadioData radioData = dataStore.ReadData(i);
-        
-        // 只返回有效数据（名称不为空）
-        if (radioData.name.length() > 0) {
+    // 只返回已占用的槽位，按批取编号，避免按槽位总数在栈上开数组
+    int slots[32];
+    int slotCount = 0;
+    int nextIndex = 1;
+    RadioData radioData;
+    while ((slotCount = dataStore.GetOccupiedSlots(slots, 32, nextIndex)) > 0) {
+        for (int n = 0; n < slotCount; n++) {
+            int i = slots[n];
+            dataStore.ReadData(i, radioData);
+            
             JsonObject item = dataArray.add<JsonObject>();
             item["index"] = i;
-            item["name"] = radioData.name;
+            // radioData 每轮复用，以 char* 传入让文档复制名称（const char* 只保存指针）
+            item["name"] = (char*)radioData.name.c_str();
             item["data"] = (unsigned long)radioData.rcData.data;
             item["bitLength"] = radioData.rcData.bitLength;
             item["protocol"] = radioData.rcData.protocal;
             item["pulseLength"] = radioData.rcData.pulseLength;
             item["freqType"] = (int)radioData.rcData.freqType;
         }
+        nextIndex = slots[slotCount - 1] + 1;
     }
     
     doc["result"] = "OK";
@@ -198,32 +243,45 @@ void WebService::handleRadioDataAddRequest(AsyncWebServerRequest *request, uint8
         return;
     }
     
-    // 查找第一个空位置
-    int emptyIndex = -1;
-    for (int i = 1; i <= 100; i++) {
-        RadioData existingData = dataStore.ReadData(i);
-        if (existingData.name.length() == 0) {
-            emptyIndex = i;
-            break;
-        }
-    }
-    
-    if (emptyIndex == -1) {
-        request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"No empty slot available\"}");
-        return;
-    }
-    
     // 创建新数据
     RadioData newData;
-    newData.name = doc["name"].as<String>();
+    newData.name = doc["name"].as<const char*>();
     newData.rcData.data = doc["data"].as<unsigned long>();
     newData.rcData.bitLength = doc["bitLength"].as<unsigned int>();
     newData.rcData.protocal = doc["protocol"].as<unsigned int>();
     newData.rcData.pulseLength = doc["pulseLength"].as<uint16_t>();
     newData.rcData.freqType = (FreqType)doc["freqType"].as<int>();
     
+    // 相同编码已保存时不重复添加，返回已有的槽位
+    int existingIndex = dataStore.FindSlotByCode(newData.rcData);
+    if (existingIndex > 0) {
+        JsonDocument responseDoc;
+        responseDoc["result"] = "OK";
+        responseDoc["index"] = existingIndex;
+        responseDoc["duplicate"] = true;
+        RadioData existingData;
+        dataStore.ReadData(existingIndex, existingData);
+        responseDoc["name"] = existingData.name.c_str();
+        
+        String output;
+        serializeJson(responseDoc, output);
+        request->send(200, "application/json", output);
+        return;
+    }
+    
+    // 查找第一个空位置
+    int emptyIndex = dataStore.FindFreeSlot();
+    
+    if (emptyIndex == -1) {
+        request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"No empty slot available\"}");
+        return;
+    }
+    
     // 保存数据
-    dataStore.SaveData(emptyIndex, newData);
+    if (!dataStore.SaveData(emptyIndex, newData)) {
+        request->send(500, "application/json", "{\"result\":\"failed\",\"message\":\"Failed to write storage\"}");
+        return;
+    }
     
     JsonDocument responseDoc;
     responseDoc["result"] = "OK";
@@ -249,21 +307,24 @@ void WebService::handleRadioDataUpdateRequest(AsyncWebServerRequest *request, ui
     }
     
     int dataIndex = doc["index"].as<int>();
-    if (dataIndex < 1 || dataIndex > 100) {
+    if (dataIndex < 1 || dataIndex > RADIO_DATA_SLOT_COUNT) {
         request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"Invalid index\"}");
         return;
     }
     
     // 更新数据
     RadioData updateData;
-    updateData.name = doc["name"].as<String>();
+    updateData.name = doc["name"].as<const char*>();
     updateData.rcData.data = doc["data"].as<unsigned long>();
     updateData.rcData.bitLength = doc["bitLength"].as<unsigned int>();
     updateData.rcData.protocal = doc["protocol"].as<unsigned int>();
     updateData.rcData.pulseLength = doc["pulseLength"].as<uint16_t>();
     updateData.rcData.freqType = (FreqType)doc["freqType"].as<int>();
     
-    dataStore.SaveData(dataIndex, updateData);
+    if (!dataStore.SaveData(dataIndex, updateData)) {
+        request->send(500, "application/json", "{\"result\":\"failed\",\"message\":\"Failed to write storage\"}");
+        return;
+    }
     
     request->send(200, "application/json", "{\"result\":\"OK\"}");
 }
@@ -283,7 +344,7 @@ void WebService::handleRadioDataDeleteRequest(AsyncWebServerRequest *request, ui
     }
     
     int dataIndex = doc["index"].as<int>();
-    if (dataIndex < 1 || dataIndex > 100) {
+    if (dataIndex < 1 || dataIndex > RADIO_DATA_SLOT_COUNT) {
         request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"Invalid index\"}");
         return;
     }
@@ -297,7 +358,10 @@ void WebService::handleRadioDataDeleteRequest(AsyncWebServerRequest *request, ui
     emptyData.rcData.pulseLength = 0;
     emptyData.rcData.freqType = FREQ_315;
     
-    dataStore.SaveData(dataIndex, emptyData);
+    if (!dataStore.SaveData(dataIndex, emptyData)) {
+        request->send(500, "application/json", "{\"result\":\"failed\",\"message\":\"Failed to write storage\"}");
+        return;
+    }
     
     request->send(200, "application/json", "{\"result\":\"OK\"}");
 }
@@ -310,7 +374,7 @@ void WebService::handleRadioDataGetRequest(AsyncWebServerRequest *request)
     }
     
     int dataIndex = request->getParam("index")->value().toInt();
-    if (dataIndex < 1 || dataIndex > 100) {
+    if (dataIndex < 1 || dataIndex > RADIO_DATA_SLOT_COUNT) {
         request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"Invalid index\"}");
         return;
     }
@@ -320,7 +384,7 @@ void WebService::handleRadioDataGetRequest(AsyncWebServerRequest *request)
     JsonDocument doc;
     doc["result"] = "OK";
     doc["index"] = dataIndex;
-    doc["name"] = radioData.name;
+    doc["name"] = radioData.name.c_str();
     doc["data"] = (unsigned long)radioData.rcData.data;
     doc["bitLength"] = radioData.rcData.bitLength;
     doc["protocol"] = radioData.rcData.protocal;
@@ -429,7 +493,7 @@ void WebService::handleRadioDataSendRequest(AsyncWebServerRequest *request, uint
     
     int dataIndex = doc["index"].as<int>();
     
-    if (dataIndex < 1 || dataIndex > 100) {
+    if (dataIndex < 1 || dataIndex > RADIO_DATA_SLOT_COUNT) {
         request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"Invalid index\"}");
         return;
     }
@@ -444,17 +508,342 @@ void WebService::handleRadioDataSendRequest(AsyncWebServerRequest *request, uint
     
     // 发送信号
     Serial.print("发送信号: ");
-    Serial.print(radioData.name);
+    Serial.print(radioData.name.c_str());
     Serial.print(" | 数据: ");
     Serial.print((unsigned long)radioData.rcData.data);
     Serial.print(" | 频率: ");
     Serial.println(radioData.rcData.freqType == FREQ_315 ? "315MHz" : "433MHz");
     
-    radioHelper.SendData(radioData.rcData);
+    if (!radioHelper.SendData(radioData.rcData)) {
+        request->send(503, "application/json", "{\"result\":\"failed\",\"message\":\"Send queue full\"}");
+        return;
+    }
     
     request->send(200, "application/json", "{\"result\":\"OK\",\"message\":\"Signal sent successfully\"}");
 }
 
+// 连续接收（嗅探）模式开关：{"enable":true,"dedupWindow":500}
+void WebService::handleSnifferEnableRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+    String jsonStr = String((char*)data).substring(0, len);
+    Serial.println("Sniffer: " + jsonStr);
+    
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, jsonStr);
+    
+    if (error) {
+        request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"Invalid JSON\"}");
+        return;
+    }
+    
+    if (doc["dedupWindow"].is<unsigned int>()) {
+        radioHelper.SetDedupWindow(doc["dedupWindow"].as<unsigned int>());
+    }
+    if (doc["enable"].as<bool>()) {
+        radioHelper.EnableSniffer();
+    } else {
+        radioHelper.DisableRecive();
+    }
+    
+    request->send(200, "application/json", "{\"result\":\"OK\"}");
+}
+
+// 读取接收帧队列：/api/radio/sniffer/frames?since=<上次返回的sequence>
+void WebService::handleSnifferFramesRequest(AsyncWebServerRequest *request)
+{
+    uint32_t cursor = 0;
+    if (request->hasParam("since")) {
+        cursor = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+    }
+    
+    JsonDocument doc;
+    JsonArray frames = doc["frames"].to<JsonArray>();
+    RadioFrame frame;
+    RadioData savedData;
+    while (radioHelper.ReadFrame(cursor, frame)) {
+        JsonObject item = frames.add<JsonObject>();
+        item["sequence"] = frame.sequence;
+        item["timestamp"] = frame.timestamp;
+        item["lastSeen"] = frame.lastSeen;
+        item["freqType"] = (int)frame.rcData.freqType;
+        item["data"] = (unsigned long)frame.rcData.data;
+        item["bitLength"] = frame.rcData.bitLength;
+        item["protocol"] = frame.rcData.protocal;
+        item["pulseLength"] = frame.rcData.pulseLength;
+        item["repeatCount"] = frame.repeatCount;
+        
+        // 已保存的编码附带槽位与名称
+        int savedIndex = dataStore.FindSlotByCode(frame.rcData);
+        if (savedIndex > 0) {
+            item["index"] = savedIndex;
+            dataStore.ReadData(savedIndex, savedData);
+            item["name"] = (char*)savedData.name.c_str();
+        }
+    }
+    
+    doc["result"] = "OK";
+    doc["enabled"] = radioHelper.IsSnifferEnabled();
+    doc["sequence"] = cursor;
+    
+    String output;
+    serializeJson(doc, output);
+    request->send(200, "application/json", output);
+}
+
+// 流式导出整个码库（NDJSON），逐块生成，不在内存中构建完整文档
+void WebService::handleRadioDataExportRequest(AsyncWebServerRequest *request)
+{
+    std::shared_ptr<RadioDataExporter> exporter = std::make_shared<RadioDataExporter>(&dataStore);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/x-ndjson",
+        [exporter](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return exporter->Read(buffer, maxLen);
+        });
+    response->addHeader("Content-Disposition", "attachment; filename=\"radiodata.ndjson\"");
+    request->send(response);
+}
+
+// 流式导入（NDJSON），请求体按分块到达，逐行解析保存；?mode=replace 覆盖已有数据
+void WebService::handleRadioDataImportRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+    if (index == 0) {
+        // 导入状态挂在请求上，请求结束时由服务器 free() 释放，
+        // 因此在 malloc 的内存上就地构造，且不能有析构函数
+        static_assert(std::is_trivially_destructible<RadioDataImporter>::value,
+                      "RadioDataImporter is released with free()");
+        void *memory = malloc(sizeof(RadioDataImporter));
+        if (memory == nullptr) {
+            request->send(500, "application/json", "{\"result\":\"failed\",\"message\":\"Out of memory\"}");
+            return;
+        }
+        RadioDataImporter *importer = new (memory) RadioDataImporter();
+        bool replace = request->hasParam("mode") && request->getParam("mode")->value() == "replace";
+        importer->Begin(&dataStore, replace);
+        request->_tempObject = importer;
+    }
+    
+    RadioDataImporter *importer = (RadioDataImporter*)request->_tempObject;
+    if (importer == nullptr) {
+        return;
+    }
+    importer->Write(data, len);
+    
+    if (index + len >= total) {
+        importer->End();
+        Serial.print("RadioData导入完成，新增: ");
+        Serial.print(importer->imported);
+        Serial.print(" 重复: ");
+        Serial.print(importer->duplicates);
+        Serial.print(" 失败: ");
+        Serial.println(importer->failed);
+        
+        JsonDocument doc;
+        doc["result"] = "OK";
+        doc["imported"] = importer->imported;
+        doc["duplicates"] = importer->duplicates;
+        doc["failed"] = importer->failed;
+        
+        String output;
+        serializeJson(doc, output);
+        request->send(200, "application/json", output);
+    }
+}
+
+// 解码器基准测试：/api/radio/benchmark?frames=50&bits=24&jitter=0&noise=0&noiseFrames=200&seed=1&index=1
+void WebService::handleRadioBenchmarkRequest(AsyncWebServerRequest *request)
+{
+    BenchmarkConfig config = RadioBenchmark::DefaultConfig();
+    if (request->hasParam("frames")) {
+        config.framesPerProtocol = request->getParam("frames")->value().toInt();
+    }
+    if (request->hasParam("bits")) {
+        config.bitLength = request->getParam("bits")->value().toInt();
+    }
+    if (request->hasParam("jitter")) {
+        config.jitter = request->getParam("jitter")->value().toInt();
+    }
+    if (request->hasParam("noise")) {
+        config.noise = request->getParam("noise")->value().toInt();
+    }
+    if (request->hasParam("noiseFrames")) {
+        config.noiseFrames = request->getParam("noiseFrames")->value().toInt();
+    }
+    if (request->hasParam("seed")) {
+        config.seed = strtoul(request->getParam("seed")->value().c_str(), nullptr, 10);
+    }
+    if (request->hasParam("index")) {
+        config.protocolIndex = request->getParam("index")->value().toInt() != 0;
+    }
+
+    RadioBenchmark benchmark;
+    JsonDocument doc;
+    benchmark.Run(config, doc);
+    doc["result"] = "OK";
+
+    String output;
+    serializeJson(doc, output);
+    request->send(200, "application/json", output);
+}
+
+void WebService::handleDataStoreBenchmarkRequest(AsyncWebServerRequest *request)
+{
+    DataStoreBenchmarkConfig config = DataStoreBenchmark::DefaultConfig();
+    if (request->hasParam("iterations")) {
+        config.iterations = request->getParam("iterations")->value().toInt();
+    }
+    if (request->hasParam("lists")) {
+        config.listPasses = request->getParam("lists")->value().toInt();
+    }
+    if (request->hasParam("configLoads")) {
+        config.configLoads = request->getParam("configLoads")->value().toInt();
+    }
+    if (request->hasParam("saves")) {
+        config.saves = request->getParam("saves")->value().toInt();
+    }
+    if (request->hasParam("cold")) {
+        config.coldLoad = request->getParam("cold")->value().toInt() != 0;
+    }
+
+    DataStoreBenchmark benchmark(&dataStore);
+    JsonDocument doc;
+    benchmark.Run(config, doc);
+    doc["result"] = "OK";
+
+    String output;
+    serializeJson(doc, output);
+    request->send(200, "application/json", output);
+}
+
+// 界面帧耗时统计：/api/gui/profiler?overlay=1&reset=1
+// overlay 开关屏幕右上角的帧率叠加层，reset 清空统计窗口
+void WebService::handleGUIProfilerRequest(AsyncWebServerRequest *request)
+{
+    if (request->hasParam("overlay")) {
+        frameProfiler.setOverlayEnabled(request->getParam("overlay")->value().toInt() != 0);
+    }
+    if (request->hasParam("reset") && request->getParam("reset")->value().toInt() != 0) {
+        frameProfiler.reset();
+    }
+
+    JsonDocument doc;
+    frameProfiler.report(doc);
+
+    DisplayStats stats = guiRender.getDisplayStats();
+    JsonObject display = doc["display"].to<JsonObject>();
+    display["frames"] = stats.frames;
+    display["skippedFrames"] = stats.skippedFrames;
+    display["partialFrames"] = stats.partialFrames;
+    display["fullFrames"] = stats.fullFrames;
+    display["tilesSent"] = stats.tilesSent;
+    display["idleWakeups"] = stats.idleWakeups;
+    display["transferWaits"] = stats.transferWaits;
+    doc["result"] = "OK";
+
+    String output;
+    serializeJson(doc, output);
+    request->send(200, "application/json", output);
+}
+
+// 屏幕截图：以PBM（P4）格式返回屏幕上当前显示的一帧，点亮的像素为1，可用于与基准图像逐位比较
+void WebService::handleGUIFrameRequest(AsyncWebServerRequest *request)
+{
+    uint8_t frame[SCREEN_WIDTH * SCREEN_TILE_HEIGHT];
+    if (!guiRender.copyFrame(frame)) {
+        request->send(503, "application/json", "{\"result\":\"failed\",\"message\":\"No frame yet\"}");
+        return;
+    }
+
+    // 分块布局（每字节为竖向8个像素）转换为按行排列、高位在前的PBM位图
+    char header[16];
+    const int headerLength = snprintf(header, sizeof(header), "P4\n%d %d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    std::shared_ptr<std::vector<uint8_t>> pbm = std::make_shared<std::vector<uint8_t>>(headerLength + SCREEN_WIDTH * SCREEN_HEIGHT / 8, 0);
+    memcpy(pbm->data(), header, headerLength);
+    uint8_t* bits = pbm->data() + headerLength;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        const uint8_t* tileRow = frame + (y / 8) * SCREEN_WIDTH;
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (tileRow[x] & (1 << (y % 8))) {
+                bits[y * (SCREEN_WIDTH / 8) + x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+    }
+
+    AsyncWebServerResponse *response = request->beginResponse("image/x-portable-bitmap", pbm->size(),
+        [pbm](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            size_t n = pbm->size() - index;
+            if (n > maxLen) {
+                n = maxLen;
+            }
+            memcpy(buffer, pbm->data() + index, n);
+            return n;
+        });
+    request->send(response);
+}
+
+// 脚本化按键：/api/gui/input?keys=menu,2,enter,back
+// 按顺序放入按键队列，由渲染任务在下一帧前依次分发给当前页面，与按下实体按键相同
+void WebService::handleGUIInputRequest(AsyncWebServerRequest *request)
+{
+    if (!request->hasParam("keys")) {
+        request->send(400, "application/json", "{\"result\":\"failed\",\"message\":\"Missing keys\"}");
+        return;
+    }
+
+    // 先解析全部按键，有无法识别的按键时整个请求不执行
+    String keys = request->getParam("keys")->value();
+    ButtonHandleEvent events[BUTTON_EVENT_QUEUE_SIZE];
+    int eventCount = 0;
+    int start = 0;
+    while (start <= (int)keys.length()) {
+        int end = keys.indexOf(',', start);
+        if (end < 0) {
+            end = keys.length();
+        }
+        String key = keys.substring(start, end);
+        key.trim();
+        start = end + 1;
+
+        ButtonHandleEvent event;
+        if (key == "back") {
+            event = BTN_BACK;
+        } else if (key == "menu") {
+            event = BTN_MENU;
+        } else if (key == "enter") {
+            event = BTN_ENTER;
+        } else if (key.length() == 1 && key[0] >= '1' && key[0] <= '9') {
+            event = (ButtonHandleEvent)(BTN_1 + (key[0] - '1'));
+        } else {
+            JsonDocument error;
+            error["result"] = "failed";
+            error["message"] = "Unknown key";
+            error["key"] = key;
+            String output;
+            serializeJson(error, output);
+            request->send(400, "application/json", output);
+            return;
+        }
+        // 超过队列容量的按键放不进队列，只检查不保存
+        if (eventCount < BUTTON_EVENT_QUEUE_SIZE) {
+            events[eventCount++] = event;
+        }
+    }
+
+    int queued = 0;
+    for (int i = 0; i < eventCount; i++) {
+        // 队列满（渲染任务来不及处理）时停止，已放入的按键仍会执行
+        if (!buttonHandle.injectEvent(events[i])) {
+            break;
+        }
+        queued++;
+    }
+
+    JsonDocument doc;
+    doc["result"] = "OK";
+    doc["queued"] = queued;
+    String output;
+    serializeJson(doc, output);
+    request->send(200, "application/json", output);
+}
+
 // ==================== MQTT/HA配置接口实现 ====================
 
 void WebService::handleMQTTConfigGetRequest(AsyncWebServerRequest *request)
@@ -32,6 +32,7 @@ public:
     void handleAPWIFIInfoRequest(AsyncWebServerRequest *request);
     void handleAPSaveRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
     void handleAPEnableRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+    void handleConfigStatsRequest(AsyncWebServerRequest *request);
     
     // 无线遥控数据管理接口
     void handleRadioDataListRequest(AsyncWebServerRequest *request);
@@ -40,6 +41,15 @@ public:
     void handleRadioDataDeleteRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
     void handleRadioDataGetRequest(AsyncWebServerRequest *request);
     void handleRadioDataSendRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+    void handleRadioDataExportRequest(AsyncWebServerRequest *request);
+    void handleRadioDataImportRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+    void handleRadioBenchmarkRequest(AsyncWebServerRequest *request);
+    void handleDataStoreBenchmarkRequest(AsyncWebServerRequest *request);
+    void handleGUIProfilerRequest(AsyncWebServerRequest *request);
+    void handleGUIFrameRequest(AsyncWebServerRequest *request);
+    void handleGUIInputRequest(AsyncWebServerRequest *request);
+    void handleSnifferEnableRequest(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+    void handleSnifferFramesRequest(AsyncWebServerRequest *request);
     
     // MQTT/HA配置接口
     void handleMQTTConfigGetRequest(AsyncWebServerRequest *request);